@@ -0,0 +1,905 @@
+/**
+ * @file concurrent_bench.c
+ * @brief Mide cómo escalan las listas concurrentes de 1 a N hilos y las somete a una prueba de estrés.
+ *
+ * Cada variante ejecuta la misma carga con 1, 2, 4... hasta --threads hilos
+ * y emite una fila por caso en CSV o JSON con el total de operaciones por
+ * segundo. La línea base es la misma estructura sin sincronizar protegida
+ * por un mutex global, que es lo que hay que usar sin las variantes
+ * concurrentes. Las cargas mixtas (read90, read50, read10) mezclan
+ * búsquedas con inserciones y eliminaciones en posiciones aleatorias en la
+ * proporción que indica su nombre. En read_mostly todos los hilos buscan y
+ * solo el primero modifica la lista, una vez cada BENCH_WRITE_EVERY
+ * búsquedas; la línea base usa un candado de lectura y escritura.
+ *
+ * Con --stress no se mide tiempo: todos los hilos insertan y sacan valores
+ * únicos a la vez y al final se comprueba que cada valor salió exactamente
+ * una vez (y, en la cola, en el orden en que lo encoló cada productor;
+ * en cdlist, insertando y sacando por ambos extremos y en medio; en
+ * rdlist, que los lectores nunca vean la lista a medio modificar).
+ * Termina con código 1 si no es así.
+ *
+ * Compilación (desde la raíz del proyecto):
+ *   gcc -O2 -Iinclude src/slist.c src/dlist.c src/node_pool.c src/aggregate.c src/par_pool.c src/value_index.c \
+ *       src/run_sort.c src/snapshot.c src/cslist.c src/epoch.c src/slist_queue.c src/cdlist.c \
+ *       src/rdlist.c \
+ *       bench/concurrent_bench.c \
+ *       -o concurrent_bench -pthread
+ *
+ * Uso:
+ *   ./concurrent_bench [--format csv|json] [--threads N] [--ops N] [--stress]
+ */
+
+#include "slist.h"
+#include "cslist.h"
+#include "slist_queue.h"
+#include "dlist.h"
+#include "cdlist.h"
+#include "rdlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define BENCH_MAX_THREADS 256
+#define BENCH_PREFILL 1024 // elementos iniciales, para que pop no encuentre siempre la lista vacía
+#define BENCH_MIXED_SIZE 1000 // elementos iniciales de las cargas mixtas
+#define BENCH_WRITE_EVERY 1024 // búsquedas entre cambios del escritor en read_mostly
+
+typedef struct BenchVariant {
+    const char *name;
+    const char *workload;
+    void *(*create)(void);
+    void (*destroy)(void *list);
+    void (*run)(void *list, int thread, long ops, int reads); // carga de un hilo
+    int per_iteration; // operaciones por iteración de run
+    int reads; // porcentaje de lecturas de las cargas mixtas
+} BenchVariant;
+
+typedef struct BenchThread {
+    const BenchVariant *variant;
+    void *list;
+    int thread;
+    long ops;
+    pthread_barrier_t *start;
+} BenchThread;
+
+static volatile long long bench_sink; // evita que el compilador elimine las operaciones
+static pthread_mutex_t bench_lock = PTHREAD_MUTEX_INITIALIZER; // mutex global de las líneas base
+static pthread_rwlock_t bench_rwlock = PTHREAD_RWLOCK_INITIALIZER; // línea base de read_mostly
+
+static double bench_now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Pila: cada iteración inserta un elemento y saca otro. */
+static void *bench_cslist_create(void) {
+    CSList *list = cslist_create();
+
+    for (int i = 0; list && i < BENCH_PREFILL; i++) cslist_push_front(list, i);
+    return list;
+}
+
+static void bench_cslist_destroy(void *list) { cslist_destroy(list); }
+
+static void bench_cslist_run(void *list, int thread, long ops, int reads) {
+    (void)reads;
+    long long sink = 0;
+    int value;
+
+    for (long i = 0; i < ops; i++) {
+        cslist_push_front(list, thread);
+        if (cslist_pop_front(list, &value) == LIST_OK) sink += value;
+    }
+
+    __atomic_fetch_add(&bench_sink, sink, __ATOMIC_RELAXED);
+}
+
+static void *bench_slist_create(void) {
+    SList *list = slist_create();
+
+    for (int i = 0; list && i < BENCH_PREFILL; i++) slist_push_front(list, i);
+    return list;
+}
+
+static void bench_slist_destroy(void *list) { slist_destroy(list); }
+
+static void bench_slist_mutex_run(void *list, int thread, long ops, int reads) {
+    (void)reads;
+    long long sink = 0;
+    int value;
+
+    for (long i = 0; i < ops; i++) {
+        pthread_mutex_lock(&bench_lock);
+        slist_push_front(list, thread);
+        pthread_mutex_unlock(&bench_lock);
+
+        pthread_mutex_lock(&bench_lock);
+        if (slist_pop_front(list, &value) == LIST_OK) sink += value;
+        pthread_mutex_unlock(&bench_lock);
+    }
+
+    __atomic_fetch_add(&bench_sink, sink, __ATOMIC_RELAXED);
+}
+
+/* Cola: cada iteración encola un elemento y desencola otro. */
+static void *bench_queue_create(void) {
+    SListQueue *queue = slist_queue_create();
+
+    for (int i = 0; queue && i < BENCH_PREFILL; i++) slist_queue_enqueue(queue, i);
+    return queue;
+}
+
+static void bench_queue_destroy(void *queue) { slist_queue_destroy(queue); }
+
+static void bench_queue_run(void *queue, int thread, long ops, int reads) {
+    (void)reads;
+    long long sink = 0;
+    int value;
+
+    for (long i = 0; i < ops; i++) {
+        slist_queue_enqueue(queue, thread);
+        if (slist_queue_dequeue(queue, &value) == LIST_OK) sink += value;
+    }
+
+    __atomic_fetch_add(&bench_sink, sink, __ATOMIC_RELAXED);
+}
+
+static void bench_slist_queue_mutex_run(void *list, int thread, long ops, int reads) {
+    (void)reads;
+    long long sink = 0;
+    int value;
+
+    for (long i = 0; i < ops; i++) {
+        pthread_mutex_lock(&bench_lock);
+        slist_push_back(list, thread);
+        pthread_mutex_unlock(&bench_lock);
+
+        pthread_mutex_lock(&bench_lock);
+        if (slist_pop_front(list, &value) == LIST_OK) sink += value;
+        pthread_mutex_unlock(&bench_lock);
+    }
+
+    __atomic_fetch_add(&bench_sink, sink, __ATOMIC_RELAXED);
+}
+
+/*
+ * Carga mixta: en cada iteración una lectura (contains o
+ * search_for_position) con probabilidad reads% o, si no, una escritura
+ * (insert_in_position y free_in_position alternadas, para que el tamaño se
+ * mantenga). Valores y posiciones son aleatorios.
+ */
+static unsigned bench_rand(unsigned *seed) {
+    *seed ^= *seed << 13; // xorshift32
+    *seed ^= *seed >> 17;
+    *seed ^= *seed << 5;
+    return *seed;
+}
+
+static void *bench_cdlist_create(void) {
+    CDList *list = cdlist_create();
+
+    for (int i = 0; list && i < BENCH_MIXED_SIZE; i++) cdlist_push_back(list, i);
+    return list;
+}
+
+static void bench_cdlist_destroy(void *list) { cdlist_destroy(list); }
+
+static void bench_cdlist_run(void *list, int thread, long ops, int reads) {
+    unsigned seed = 2463534242u + (unsigned)thread * 7919u;
+    long long sink = 0;
+    int insert = 1;
+    int value;
+    bool found;
+
+    for (long i = 0; i < ops; i++) {
+        unsigned r = bench_rand(&seed);
+        int pos = (int)(bench_rand(&seed) % BENCH_MIXED_SIZE) + 1;
+
+        if ((int)(r % 100) < reads) {
+            if (r & 128) {
+                cdlist_contains(list, pos * 2, &found); // la mitad de los valores no está
+                sink += found;
+            } else if (cdlist_search_for_position(list, pos, &value) == LIST_OK) {
+                sink += value;
+            }
+        } else {
+            if (insert) cdlist_insert_in_position(list, pos, pos);
+            else cdlist_free_in_position(list, pos);
+            insert = !insert;
+        }
+    }
+
+    __atomic_fetch_add(&bench_sink, sink, __ATOMIC_RELAXED);
+}
+
+static void *bench_dlist_create(void) {
+    DList *list = dlist_create();
+
+    for (int i = 0; list && i < BENCH_MIXED_SIZE; i++) dlist_push_back(list, i);
+    return list;
+}
+
+static void bench_dlist_destroy(void *list) { dlist_destroy(list); }
+
+static void bench_dlist_mutex_run(void *list, int thread, long ops, int reads) {
+    unsigned seed = 2463534242u + (unsigned)thread * 7919u;
+    long long sink = 0;
+    int insert = 1;
+    int value;
+    bool found;
+
+    for (long i = 0; i < ops; i++) {
+        unsigned r = bench_rand(&seed);
+        int pos = (int)(bench_rand(&seed) % BENCH_MIXED_SIZE) + 1;
+
+        pthread_mutex_lock(&bench_lock);
+        if ((int)(r % 100) < reads) {
+            if (r & 128) {
+                dlist_contains(list, pos * 2, &found);
+                sink += found;
+            } else if (dlist_search_for_position(list, pos, &value) == LIST_OK) {
+                sink += value;
+            }
+        } else {
+            if (insert) dlist_insert_in_position(list, pos, pos);
+            else dlist_free_in_position(list, pos);
+            insert = !insert;
+        }
+        pthread_mutex_unlock(&bench_lock);
+    }
+
+    __atomic_fetch_add(&bench_sink, sink, __ATOMIC_RELAXED);
+}
+
+/*
+ * Carga read_mostly: cada iteración es un contains de un valor aleatorio;
+ * el hilo 0 además inserta o elimina en una posición aleatoria cada
+ * BENCH_WRITE_EVERY iteraciones.
+ */
+static void *bench_rdlist_create(void) {
+    RDList *list = rdlist_create();
+
+    for (int i = 0; list && i < BENCH_MIXED_SIZE; i++) rdlist_push_back(list, i);
+    return list;
+}
+
+static void bench_rdlist_destroy(void *list) { rdlist_destroy(list); }
+
+static void bench_rdlist_run(void *list, int thread, long ops, int reads) {
+    unsigned seed = 2463534242u + (unsigned)thread * 7919u;
+    long long sink = 0;
+    int insert = 1;
+    bool found;
+
+    (void)reads;
+    for (long i = 0; i < ops; i++) {
+        int pos = (int)(bench_rand(&seed) % BENCH_MIXED_SIZE) + 1;
+
+        if (thread == 0 && i % BENCH_WRITE_EVERY == 0) {
+            if (insert) rdlist_insert_in_position(list, pos, pos);
+            else rdlist_free_in_position(list, pos);
+            insert = !insert;
+        }
+
+        rdlist_contains(list, pos * 2, &found);
+        sink += found;
+    }
+
+    __atomic_fetch_add(&bench_sink, sink, __ATOMIC_RELAXED);
+}
+
+static void bench_dlist_rwlock_run(void *list, int thread, long ops, int reads) {
+    unsigned seed = 2463534242u + (unsigned)thread * 7919u;
+    long long sink = 0;
+    int insert = 1;
+    bool found;
+
+    (void)reads;
+    for (long i = 0; i < ops; i++) {
+        int pos = (int)(bench_rand(&seed) % BENCH_MIXED_SIZE) + 1;
+
+        if (thread == 0 && i % BENCH_WRITE_EVERY == 0) {
+            pthread_rwlock_wrlock(&bench_rwlock);
+            if (insert) dlist_insert_in_position(list, pos, pos);
+            else dlist_free_in_position(list, pos);
+            pthread_rwlock_unlock(&bench_rwlock);
+            insert = !insert;
+        }
+
+        pthread_rwlock_rdlock(&bench_rwlock);
+        dlist_contains(list, pos * 2, &found);
+        pthread_rwlock_unlock(&bench_rwlock);
+        sink += found;
+    }
+
+    __atomic_fetch_add(&bench_sink, sink, __ATOMIC_RELAXED);
+}
+
+static const BenchVariant variants[] = {
+    {"cslist", "stack", bench_cslist_create, bench_cslist_destroy, bench_cslist_run, 2, 0},
+    {"slist_mutex", "stack", bench_slist_create, bench_slist_destroy, bench_slist_mutex_run, 2, 0},
+    {"slist_queue", "queue", bench_queue_create, bench_queue_destroy, bench_queue_run, 2, 0},
+    {"slist_mutex", "queue", bench_slist_create, bench_slist_destroy, bench_slist_queue_mutex_run, 2, 0},
+    {"cdlist", "read90", bench_cdlist_create, bench_cdlist_destroy, bench_cdlist_run, 1, 90},
+    {"dlist_mutex", "read90", bench_dlist_create, bench_dlist_destroy, bench_dlist_mutex_run, 1, 90},
+    {"cdlist", "read50", bench_cdlist_create, bench_cdlist_destroy, bench_cdlist_run, 1, 50},
+    {"dlist_mutex", "read50", bench_dlist_create, bench_dlist_destroy, bench_dlist_mutex_run, 1, 50},
+    {"cdlist", "read10", bench_cdlist_create, bench_cdlist_destroy, bench_cdlist_run, 1, 10},
+    {"dlist_mutex", "read10", bench_dlist_create, bench_dlist_destroy, bench_dlist_mutex_run, 1, 10},
+    {"rdlist", "read_mostly", bench_rdlist_create, bench_rdlist_destroy, bench_rdlist_run, 1, 0},
+    {"dlist_rwlock", "read_mostly", bench_dlist_create, bench_dlist_destroy, bench_dlist_rwlock_run, 1, 0},
+};
+
+static void *bench_thread(void *arg) {
+    BenchThread *task = arg;
+
+    pthread_barrier_wait(task->start);
+    task->variant->run(task->list, task->thread, task->ops, task->variant->reads);
+    return NULL;
+}
+
+/* Ejecuta la carga con threads hilos y devuelve los ns totales, o -1 si no se pudo crear la lista. */
+static double bench_case(const BenchVariant *variant, int threads, long ops) {
+    pthread_t handles[BENCH_MAX_THREADS];
+    BenchThread tasks[BENCH_MAX_THREADS];
+    pthread_barrier_t start;
+    void *list = variant->create();
+    int started = 0;
+
+    if (!list) return -1;
+
+    pthread_barrier_init(&start, NULL, (unsigned)threads + 1);
+    for (int t = 0; t < threads; t++) {
+        tasks[t].variant = variant;
+        tasks[t].list = list;
+        tasks[t].thread = t;
+        tasks[t].ops = ops;
+        tasks[t].start = &start;
+
+        if (pthread_create(&handles[t], NULL, bench_thread, &tasks[t]) != 0) break;
+        started++;
+    }
+
+    if (started < threads) { // la barrera nunca se completaría
+        fprintf(stderr, "no se pudieron crear %d hilos\n", threads);
+        exit(1);
+    }
+
+    pthread_barrier_wait(&start);
+    double begin = bench_now();
+
+    for (int t = 0; t < threads; t++) pthread_join(handles[t], NULL);
+
+    double elapsed = bench_now() - begin;
+
+    pthread_barrier_destroy(&start);
+    variant->destroy(list);
+    return elapsed;
+}
+
+/*
+ * Estrés de la pila: el hilo t inserta los valores [t * per, (t + 1) * per)
+ * y saca uno de cada dos; cada valor sacado se marca en seen. Al final se
+ * vacía la pila y todo valor debe estar marcado exactamente una vez.
+ */
+typedef struct StressThread {
+    void *list; // CSList o CDList
+    int thread;
+    int per;
+    unsigned char *seen;
+    pthread_barrier_t *start;
+} StressThread;
+
+static void stress_mark(unsigned char *seen, int value) {
+    __atomic_fetch_add(&seen[value], 1, __ATOMIC_RELAXED);
+}
+
+static void *stress_thread(void *arg) {
+    StressThread *task = arg;
+    int value;
+
+    pthread_barrier_wait(task->start);
+    for (int i = 0; i < task->per; i++) {
+        while (cslist_push_front(task->list, task->thread * task->per + i) != LIST_OK) {}
+
+        if ((i & 1) && cslist_pop_front(task->list, &value) == LIST_OK) stress_mark(task->seen, value);
+    }
+
+    return NULL;
+}
+
+static int stress_stack(int threads, int per) {
+    pthread_t handles[BENCH_MAX_THREADS];
+    StressThread tasks[BENCH_MAX_THREADS];
+    pthread_barrier_t start;
+    CSList *list = cslist_create();
+    size_t total = (size_t)threads * (size_t)per;
+    unsigned char *seen = calloc(total, 1);
+    int value;
+    int count;
+    int errors = 0;
+
+    if (!list || !seen) {
+        fprintf(stderr, "sin memoria para la prueba de estrés\n");
+        return 1;
+    }
+
+    pthread_barrier_init(&start, NULL, (unsigned)threads);
+    for (int t = 0; t < threads; t++) {
+        tasks[t].list = list;
+        tasks[t].thread = t;
+        tasks[t].per = per;
+        tasks[t].seen = seen;
+        tasks[t].start = &start;
+
+        if (pthread_create(&handles[t], NULL, stress_thread, &tasks[t]) != 0) {
+            fprintf(stderr, "no se pudieron crear %d hilos\n", threads);
+            return 1;
+        }
+    }
+
+    for (int t = 0; t < threads; t++) pthread_join(handles[t], NULL);
+    pthread_barrier_destroy(&start);
+
+    while (cslist_pop_front(list, &value) == LIST_OK) stress_mark(seen, value); // vaciamos lo que quedó
+
+    for (size_t v = 0; v < total; v++) {
+        if (seen[v] != 1) {
+            if (errors < 10) fprintf(stderr, "el valor %zu salió %d veces\n", v, seen[v]);
+            errors++;
+        }
+    }
+
+    cslist_size(list, &count);
+    if (count != 0) {
+        fprintf(stderr, "size es %d con la pila vacía\n", count);
+        errors++;
+    }
+
+    printf("stress cslist: %d hilos, %zu valores, %s\n", threads, total, errors ? "FALLÓ" : "ok");
+
+    cslist_destroy(list);
+    free(seen);
+    return errors ? 1 : 0;
+}
+
+/*
+ * Estrés de la cola: la mitad de los hilos (al menos uno) encola los valores
+ * [t * per, (t + 1) * per), unos de uno en uno y otros en lotes; el resto
+ * desencola hasta sacar todos. Cada consumidor debe ver los valores de un
+ * mismo productor en orden creciente.
+ */
+#define STRESS_BATCH 16
+
+typedef struct QueueStressThread {
+    SListQueue *queue;
+    int thread;
+    int producers;
+    int per;
+    unsigned char *seen;
+    long long *consumed; // valores sacados entre todos los consumidores
+    long long total;
+    int errors;
+    pthread_barrier_t *start;
+} QueueStressThread;
+
+static void *queue_stress_thread(void *arg) {
+    QueueStressThread *task = arg;
+    int base = task->thread * task->per;
+
+    pthread_barrier_wait(task->start);
+
+    if (task->thread < task->producers) { // productor
+        int batch[STRESS_BATCH];
+
+        for (int i = 0; i < task->per;) {
+            if (task->thread & 1) { // productores impares encolan en lotes
+                int n = task->per - i < STRESS_BATCH ? task->per - i : STRESS_BATCH;
+
+                for (int j = 0; j < n; j++) batch[j] = base + i + j;
+                if (slist_queue_enqueue_many(task->queue, batch, (size_t)n) == LIST_OK) i += n;
+            } else if (slist_queue_enqueue(task->queue, base + i) == LIST_OK) {
+                i++;
+            }
+        }
+
+        return NULL;
+    }
+
+    int *last = malloc((size_t)task->producers * sizeof(int)); // último valor visto de cada productor
+    int value;
+
+    if (!last) {
+        task->errors++;
+        return NULL;
+    }
+
+    for (int p = 0; p < task->producers; p++) last[p] = -1;
+
+    while (__atomic_load_n(task->consumed, __ATOMIC_RELAXED) < task->total) {
+        if (slist_queue_dequeue(task->queue, &value) != LIST_OK) continue;
+
+        int producer = value / task->per;
+
+        if (value <= last[producer]) task->errors++; // fuera de orden
+        last[producer] = value;
+        stress_mark(task->seen, value);
+        __atomic_fetch_add(task->consumed, 1, __ATOMIC_RELAXED);
+    }
+
+    free(last);
+    return NULL;
+}
+
+static int stress_queue(int threads, int per) {
+    pthread_t handles[BENCH_MAX_THREADS];
+    QueueStressThread tasks[BENCH_MAX_THREADS];
+    pthread_barrier_t start;
+    int consumers = threads / 2 > 0 ? threads / 2 : 1;
+    int producers = threads - consumers > 0 ? threads - consumers : 1;
+    SListQueue *queue = slist_queue_create();
+    size_t total = (size_t)producers * (size_t)per;
+    unsigned char *seen = calloc(total, 1);
+    long long consumed = 0;
+    int count;
+    int errors = 0;
+
+    if (!queue || !seen) {
+        fprintf(stderr, "sin memoria para la prueba de estrés\n");
+        return 1;
+    }
+
+    pthread_barrier_init(&start, NULL, (unsigned)(producers + consumers));
+    for (int t = 0; t < producers + consumers; t++) {
+        tasks[t].queue = queue;
+        tasks[t].thread = t;
+        tasks[t].producers = producers;
+        tasks[t].per = per;
+        tasks[t].seen = seen;
+        tasks[t].consumed = &consumed;
+        tasks[t].total = (long long)total;
+        tasks[t].errors = 0;
+        tasks[t].start = &start;
+
+        if (pthread_create(&handles[t], NULL, queue_stress_thread, &tasks[t]) != 0) {
+            fprintf(stderr, "no se pudieron crear %d hilos\n", producers + consumers);
+            return 1;
+        }
+    }
+
+    for (int t = 0; t < producers + consumers; t++) {
+        pthread_join(handles[t], NULL);
+        errors += tasks[t].errors;
+    }
+    pthread_barrier_destroy(&start);
+
+    if (errors) fprintf(stderr, "%d valores salieron fuera de orden\n", errors);
+
+    for (size_t v = 0; v < total; v++) {
+        if (seen[v] != 1) {
+            if (errors < 10) fprintf(stderr, "el valor %zu salió %d veces\n", v, seen[v]);
+            errors++;
+        }
+    }
+
+    slist_queue_size(queue, &count);
+    if (count != 0) {
+        fprintf(stderr, "size es %d con la cola vacía\n", count);
+        errors++;
+    }
+
+    printf("stress slist_queue: %d productores, %d consumidores, %zu valores, %s\n", producers, consumers,
+           total, errors ? "FALLÓ" : "ok");
+
+    slist_queue_destroy(queue);
+    free(seen);
+    return errors ? 1 : 0;
+}
+
+/*
+ * Estrés de cdlist: el hilo t inserta los valores [t * per, (t + 1) * per)
+ * al final, al inicio o en una posición cercana al inicio, y en una de cada
+ * dos iteraciones saca un valor por el inicio o por el final. De vez en
+ * cuando recorre la lista entera con contains. Al final se vacía la lista
+ * por ambos extremos y todo valor debe haber salido exactamente una vez.
+ */
+#define STRESS_CDLIST_PER 20000 // la lista crece a threads * per / 2 y se recorre entera
+
+static void *cdlist_stress_thread(void *arg) {
+    StressThread *task = arg;
+    CDList *list = task->list;
+    unsigned seed = 2463534242u + (unsigned)task->thread * 7919u;
+    int value;
+    bool found;
+
+    pthread_barrier_wait(task->start);
+    for (int i = 0; i < task->per; i++) {
+        int new = task->thread * task->per + i;
+        unsigned r = bench_rand(&seed);
+
+        switch (r % 3) {
+        case 0:
+            while (cdlist_push_back(list, new) != LIST_OK) {}
+            break;
+        case 1:
+            while (cdlist_push_front(list, new) != LIST_OK) {}
+            break;
+        default: // la posición puede quedar fuera de rango si otros hilos vaciaron la lista
+            if (cdlist_insert_in_position(list, new, (int)(r >> 8) % 8 + 1) != LIST_OK) {
+                while (cdlist_push_front(list, new) != LIST_OK) {}
+            }
+            break;
+        }
+
+        if (i & 1) {
+            ListStatus status = (r & 64) ? cdlist_pop_back(list, &value) : cdlist_pop_front(list, &value);
+
+            if (status == LIST_OK) stress_mark(task->seen, value);
+        }
+
+        if (i % 1024 == 0) cdlist_contains(list, -1, &found);
+    }
+
+    return NULL;
+}
+
+static int stress_cdlist(int threads, int per) {
+    pthread_t handles[BENCH_MAX_THREADS];
+    StressThread tasks[BENCH_MAX_THREADS];
+    pthread_barrier_t start;
+    CDList *list = cdlist_create();
+    size_t total;
+    unsigned char *seen;
+    int value;
+    int count;
+    int errors = 0;
+
+    if (per > STRESS_CDLIST_PER) per = STRESS_CDLIST_PER;
+    total = (size_t)threads * (size_t)per;
+    seen = calloc(total, 1);
+
+    if (!list || !seen) {
+        fprintf(stderr, "sin memoria para la prueba de estrés\n");
+        return 1;
+    }
+
+    pthread_barrier_init(&start, NULL, (unsigned)threads);
+    for (int t = 0; t < threads; t++) {
+        tasks[t].list = list;
+        tasks[t].thread = t;
+        tasks[t].per = per;
+        tasks[t].seen = seen;
+        tasks[t].start = &start;
+
+        if (pthread_create(&handles[t], NULL, cdlist_stress_thread, &tasks[t]) != 0) {
+            fprintf(stderr, "no se pudieron crear %d hilos\n", threads);
+            return 1;
+        }
+    }
+
+    for (int t = 0; t < threads; t++) pthread_join(handles[t], NULL);
+    pthread_barrier_destroy(&start);
+
+    for (int back = 0;; back = !back) { // vaciamos lo que quedó por ambos extremos
+        ListStatus status = back ? cdlist_pop_back(list, &value) : cdlist_pop_front(list, &value);
+
+        if (status != LIST_OK) break;
+        stress_mark(seen, value);
+    }
+
+    for (size_t v = 0; v < total; v++) {
+        if (seen[v] != 1) {
+            if (errors < 10) fprintf(stderr, "el valor %zu salió %d veces\n", v, seen[v]);
+            errors++;
+        }
+    }
+
+    cdlist_size(list, &count);
+    if (count != 0) {
+        fprintf(stderr, "size es %d con la lista vacía\n", count);
+        errors++;
+    }
+
+    printf("stress cdlist: %d hilos, %zu valores, %s\n", threads, total, errors ? "FALLÓ" : "ok");
+
+    cdlist_destroy(list);
+    free(seen);
+    return errors ? 1 : 0;
+}
+
+/*
+ * Estrés de rdlist: la lista está siempre ordenada de menor a mayor. El
+ * hilo 0 escribe (saca del inicio, agrega al final un valor mayor que
+ * todos y reemplaza elementos por su mismo valor) y los demás copian la
+ * lista entera y comprueban que sigue ordenada y sin repetidos.
+ */
+#define STRESS_RDLIST_SIZE 256 // elementos que mantiene el escritor
+
+typedef struct RDListStressThread {
+    RDList *list;
+    int thread;
+    int per;
+    int *done; // el escritor terminó
+    int errors;
+    pthread_barrier_t *start;
+} RDListStressThread;
+
+static void *rdlist_stress_thread(void *arg) {
+    RDListStressThread *task = arg;
+    int next = STRESS_RDLIST_SIZE;
+    int value;
+
+    pthread_barrier_wait(task->start);
+
+    if (task->thread == 0) { // escritor
+        for (int i = 0; i < task->per; i++) {
+            rdlist_pop_front(task->list, &value);
+            while (rdlist_push_back(task->list, next) != LIST_OK) {}
+            next++;
+
+            int pos = i % STRESS_RDLIST_SIZE + 1;
+
+            if (rdlist_search_for_position(task->list, pos, &value) == LIST_OK) {
+                rdlist_change_value(task->list, value, pos);
+            }
+        }
+
+        __atomic_store_n(task->done, 1, __ATOMIC_RELEASE);
+        return NULL;
+    }
+
+    int out[STRESS_RDLIST_SIZE * 2];
+    size_t written;
+
+    while (!__atomic_load_n(task->done, __ATOMIC_ACQUIRE)) {
+        // un recorrido lento puede ver además los elementos agregados mientras avanzaba
+        rdlist_to_array(task->list, out, STRESS_RDLIST_SIZE * 2, &written);
+
+        if (written < STRESS_RDLIST_SIZE - 1) task->errors++; // perdió nodos
+        for (size_t i = 1; i < written; i++) {
+            if (out[i] <= out[i - 1]) task->errors++; // desordenada o repetida
+        }
+    }
+
+    return NULL;
+}
+
+static int stress_rdlist(int threads, int per) {
+    pthread_t handles[BENCH_MAX_THREADS];
+    RDListStressThread tasks[BENCH_MAX_THREADS];
+    pthread_barrier_t start;
+    RDList *list = rdlist_create();
+    int done = 0;
+    int errors = 0;
+
+    if (!list) {
+        fprintf(stderr, "sin memoria para la prueba de estrés\n");
+        return 1;
+    }
+
+    for (int i = 0; i < STRESS_RDLIST_SIZE; i++) {
+        if (rdlist_push_back(list, i) != LIST_OK) {
+            fprintf(stderr, "sin memoria para la prueba de estrés\n");
+            return 1;
+        }
+    }
+
+    pthread_barrier_init(&start, NULL, (unsigned)threads);
+    for (int t = 0; t < threads; t++) {
+        tasks[t].list = list;
+        tasks[t].thread = t;
+        tasks[t].per = per;
+        tasks[t].done = &done;
+        tasks[t].errors = 0;
+        tasks[t].start = &start;
+
+        if (pthread_create(&handles[t], NULL, rdlist_stress_thread, &tasks[t]) != 0) {
+            fprintf(stderr, "no se pudieron crear %d hilos\n", threads);
+            return 1;
+        }
+    }
+
+    for (int t = 0; t < threads; t++) {
+        pthread_join(handles[t], NULL);
+        errors += tasks[t].errors;
+    }
+    pthread_barrier_destroy(&start);
+
+    if (errors) fprintf(stderr, "%d copias de la lista salieron incompletas o desordenadas\n", errors);
+
+    printf("stress rdlist: 1 escritor, %d lectores, %d cambios, %s\n", threads - 1, per * 3,
+           errors ? "FALLÓ" : "ok");
+
+    rdlist_synchronize();
+    rdlist_destroy(list);
+    return errors ? 1 : 0;
+}
+
+static void usage(const char *program) {
+    fprintf(stderr, "uso: %s [--format csv|json] [--threads N] [--ops N] [--stress]\n", program);
+}
+
+int main(int argc, char *argv[]) {
+    const char *format = "csv";
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int max_threads = cpus > 1 ? (int)cpus : 2;
+    long ops = 1000000;
+    int run_stress = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--format") && i + 1 < argc) {
+            format = argv[++i];
+        } else if (!strcmp(argv[i], "--threads") && i + 1 < argc) {
+            max_threads = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--ops") && i + 1 < argc) {
+            ops = atol(argv[++i]);
+        } else if (!strcmp(argv[i], "--stress")) {
+            run_stress = 1;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (max_threads < 1 || max_threads > BENCH_MAX_THREADS || ops < 1) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (run_stress) {
+        int per = (int)(ops > 1000000 ? 1000000 : ops);
+        int failed = stress_stack(max_threads, per);
+
+        failed |= stress_queue(max_threads, per);
+        failed |= stress_cdlist(max_threads, per);
+        return stress_rdlist(max_threads, per) || failed;
+    }
+
+    int json = !strcmp(format, "json");
+    int first_row = 1;
+
+    if (json) printf("[\n");
+    else printf("variant,workload,threads,ops,ns_per_op,ops_per_sec\n");
+
+    for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); v++) {
+        const BenchVariant *variant = &variants[v];
+
+        for (int threads = 1;; threads = threads * 2 < max_threads ? threads * 2 : max_threads) { // 1, 2, 4... N
+            double elapsed = bench_case(variant, threads, ops);
+
+            if (elapsed < 0) {
+                fprintf(stderr, "sin memoria para %s\n", variant->name);
+                return 1;
+            }
+
+            long long total = (long long)threads * ops * variant->per_iteration;
+            double ns_per_op = elapsed / (double)total;
+            double ops_per_sec = elapsed > 0 ? total * 1e9 / elapsed : 0.0;
+
+            if (json) {
+                printf("%s  {\"variant\": \"%s\", \"workload\": \"%s\", \"threads\": %d, \"ops\": %lld, "
+                       "\"ns_per_op\": %.2f, \"ops_per_sec\": %.2f}",
+                       first_row ? "" : ",\n", variant->name, variant->workload, threads, total,
+                       ns_per_op, ops_per_sec);
+            } else {
+                printf("%s,%s,%d,%lld,%.2f,%.2f\n", variant->name, variant->workload, threads, total,
+                       ns_per_op, ops_per_sec);
+            }
+
+            first_row = 0;
+            fflush(stdout);
+
+            if (threads == max_threads) break;
+        }
+    }
+
+    if (json) printf("\n]\n");
+    return 0;
+}
@@ -0,0 +1,732 @@
+/**
+ * @file list_bench.c
+ * @brief Mide ns/op y operaciones por segundo de cada función pública de slist.h y dlist.h.
+ *
+ * Para cada variante de lista, tamaño (de 1e2 hasta --max-size) y patrón de
+ * acceso (secuencial, posiciones aleatorias o cerca de tail) ejecuta cada
+ * operación hasta cumplir un tiempo mínimo y emite una fila por caso en CSV
+ * o JSON, lista para comparar antes y después de un cambio.
+ *
+ * Compilación (desde la raíz del proyecto):
+ *   gcc -O2 -Iinclude src/slist.c src/dlist.c src/node_pool.c src/aggregate.c src/par_pool.c \
+ *       src/value_index.c src/run_sort.c src/snapshot.c src/xlist.c src/zlist.c bench/list_bench.c \
+ *       -o list_bench -pthread
+ *
+ * Uso:
+ *   ./list_bench [--format csv|json] [--max-size N] [--min-time-ms MS]
+ *                [--variants basic|all] [--op NOMBRE] [--memory]
+ *
+ * Con --memory no se mide tiempo: se imprimen los bytes por elemento que
+ * reporta *_size_bytes para cada variante y tamaño.
+ */
+
+#include "slist.h"
+#include "dlist.h"
+#include "xlist.h"
+#include "zlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef enum {
+    PATTERN_SEQ = 1 << 0, // posiciones 1, 2, 3...
+    PATTERN_RANDOM = 1 << 1, // posiciones uniformes
+    PATTERN_TAIL = 1 << 2 // últimas posiciones de la lista
+} Pattern;
+
+typedef struct BenchCtx {
+    int size; // tamaño con el que se construye la lista
+    int count; // tamaño actual (seguido por el benchmark)
+    Pattern pattern;
+    int next_pos; // siguiente posición del patrón secuencial
+    unsigned seed;
+    const int *values; // valores 0..max-1 en orden
+    const int *shuffled; // los mismos valores permutados
+    const int *source; // valores con los que se construye la lista del caso
+    int *scratch; // destino de to_array (cabe la lista al doble)
+    int fd; // archivo temporal de save_load
+    void *cursor; // SListCursor o DListCursor de los benchmarks de cursor
+    void *(*create)(void); // constructor de la variante
+} BenchCtx;
+
+typedef void (*BenchFn)(void **list, BenchCtx *ctx);
+
+#define WHOLE (-1)
+
+typedef struct BenchOp {
+    const char *name;
+    BenchFn run;
+    unsigned patterns; // patrones que aplican
+    int delta; // cambio de tamaño por operación
+    int fresh; // 1 si cada operación necesita una lista recién construida
+    int elements; // elementos por operación (WHOLE si recorre toda la lista)
+} BenchOp;
+
+typedef struct BenchVariant {
+    const char *name;
+    void *(*create)(void);
+    void (*build)(void **list, BenchCtx *ctx);
+    void (*destroy)(void *list);
+    size_t (*bytes)(void *list); // *_size_bytes de la lista
+    const BenchOp *ops;
+    int basic; // se ejecuta sin --variants all
+} BenchVariant;
+
+static volatile long long bench_sink; // evita que el compilador elimine las operaciones
+
+static double bench_now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static unsigned bench_rand(BenchCtx *ctx) {
+    ctx->seed ^= ctx->seed << 13; // xorshift32
+    ctx->seed ^= ctx->seed >> 17;
+    ctx->seed ^= ctx->seed << 5;
+    return ctx->seed;
+}
+
+/* Posición en [1, limit] según el patrón del caso. */
+static int bench_pos(BenchCtx *ctx, int limit) {
+    if (limit < 1) return 1;
+
+    switch (ctx->pattern) {
+        case PATTERN_RANDOM:
+            return 1 + (int)(bench_rand(ctx) % (unsigned)limit);
+        case PATTERN_TAIL: {
+            int pos = limit - (int)(bench_rand(ctx) % 8);
+            return pos < 1 ? 1 : pos;
+        }
+        default:
+            if (ctx->next_pos > limit) ctx->next_pos = 1;
+            return ctx->next_pos++;
+    }
+}
+
+/* Valor a buscar: la lista se construye con value == pos - 1. */
+static int bench_value(BenchCtx *ctx) {
+    return bench_pos(ctx, ctx->count) - 1;
+}
+
+static int bench_compare_int(const void *a, const void *b) {
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+
+    return (x > y) - (x < y);
+}
+
+static bool bench_is_odd(int value, void *ctx) {
+    (void)ctx;
+    return value & 1;
+}
+
+/*
+ * Genera las operaciones de una familia de listas (slist o dlist), cuyas
+ * APIs son simétricas.
+ */
+#define BENCH_KIND(K, T)                                                              \
+static void K##_bench_build(void **list, BenchCtx *ctx) {                             \
+    *list = ctx->create();                                                            \
+    K##_extend(*list, ctx->source, (size_t)ctx->size);                                \
+}                                                                                     \
+static void K##_bench_destroy(void *list) { if (list) K##_destroy(list); }           \
+static size_t K##_bench_bytes(void *list) { size_t b = 0; K##_size_bytes(list, &b); return b; } \
+static void K##_op_size(void **l, BenchCtx *c) { int v; K##_size(*l, &v); bench_sink += v; (void)c; } \
+static void K##_op_size_bytes(void **l, BenchCtx *c) { size_t v; K##_size_bytes(*l, &v); bench_sink += (long long)v; (void)c; } \
+static void K##_op_is_empty(void **l, BenchCtx *c) { bool v; K##_is_empty(*l, &v); bench_sink += v; (void)c; } \
+static void K##_op_front(void **l, BenchCtx *c) { int v; K##_front(*l, &v); bench_sink += v; (void)c; } \
+static void K##_op_back(void **l, BenchCtx *c) { int v; K##_back(*l, &v); bench_sink += v; (void)c; } \
+static void K##_op_contains(void **l, BenchCtx *c) { bool v; K##_contains(*l, bench_value(c), &v); bench_sink += v; } \
+static void K##_op_search_for_value(void **l, BenchCtx *c) { int v = 0; K##_search_for_value(*l, bench_value(c), &v); bench_sink += v; } \
+static void K##_op_search_for_position(void **l, BenchCtx *c) { int v; K##_search_for_position(*l, bench_pos(c, c->count), &v); bench_sink += v; } \
+static void K##_op_change_value(void **l, BenchCtx *c) { int p = bench_pos(c, c->count); K##_change_value(*l, p - 1, p); } \
+static void K##_op_insert_in_position(void **l, BenchCtx *c) { int p = bench_pos(c, c->count + 1); K##_insert_in_position(*l, p - 1, p); c->count++; } \
+static void K##_op_free_in_position(void **l, BenchCtx *c) { K##_free_in_position(*l, bench_pos(c, c->count)); c->count--; } \
+static void K##_op_pop_front(void **l, BenchCtx *c) { int v; K##_pop_front(*l, &v); bench_sink += v; c->count--; } \
+static void K##_op_pop_front_n(void **l, BenchCtx *c) { int v[8]; K##_pop_front_n(*l, v, 8); bench_sink += v[7]; c->count -= 8; } \
+static void K##_op_push_back(void **l, BenchCtx *c) { K##_push_back(*l, c->count); c->count++; } \
+static void K##_op_push_front(void **l, BenchCtx *c) { K##_push_front(*l, c->count); c->count++; } \
+static void K##_op_sum(void **l, BenchCtx *c) { int v; K##_sum(*l, &v); bench_sink += v; (void)c; } \
+static void K##_op_sum64(void **l, BenchCtx *c) { long long v; K##_sum64(*l, &v); bench_sink += v; (void)c; } \
+static void K##_op_min(void **l, BenchCtx *c) { int v; K##_min(*l, &v); bench_sink += v; (void)c; } \
+static void K##_op_max(void **l, BenchCtx *c) { int v; K##_max(*l, &v); bench_sink += v; (void)c; } \
+static void K##_op_minmax(void **l, BenchCtx *c) { int a, b; K##_minmax(*l, &a, &b); bench_sink += a + b; (void)c; } \
+static void K##_op_count_if_equal(void **l, BenchCtx *c) { int v; K##_count_if_equal(*l, bench_value(c), &v); bench_sink += v; } \
+static void K##_op_aggregate(void **l, BenchCtx *c) {                                 \
+    ListAggregate r;                                                                  \
+    K##_aggregate(*l, LIST_AGG_SUM | LIST_AGG_MIN | LIST_AGG_MAX | LIST_AGG_COUNT_EQUAL, 0, &r); \
+    bench_sink += r.sum; (void)c;                                                     \
+}                                                                                     \
+static void K##_op_to_array(void **l, BenchCtx *c) { size_t w; K##_to_array(*l, c->scratch, (size_t)c->count, &w); bench_sink += (long long)w; } \
+static void K##_op_extend(void **l, BenchCtx *c) { K##_extend(*l, c->values, (size_t)c->size); } \
+static void K##_op_extend_front(void **l, BenchCtx *c) { K##_extend_front(*l, c->values, (size_t)c->size); } \
+static void K##_op_remove_if(void **l, BenchCtx *c) { size_t r; K##_remove_if(*l, bench_is_odd, NULL, &r); bench_sink += (long long)r; (void)c; } \
+static void K##_op_remove_value(void **l, BenchCtx *c) { size_t r; K##_remove_value(*l, bench_value(c), &r); c->count -= (int)r; } \
+static void K##_op_remove_range(void **l, BenchCtx *c) { int p = bench_pos(c, c->count - 7); K##_remove_range(*l, p, p + 7); c->count -= 8; } \
+static void K##_op_split_concat(void **l, BenchCtx *c) { /* split_at y concat devuelven la lista a su estado */ \
+    T *tail = NULL;                                                                   \
+    if (K##_split_at(*l, bench_pos(c, c->count), &tail) == LIST_OK) {                  \
+        K##_concat(*l, tail); K##_destroy(tail);                                      \
+    }                                                                                 \
+}                                                                                     \
+static void K##_op_save_load(void **l, BenchCtx *c) { /* guarda y vuelve a cargar la lista */ \
+    T *loaded = NULL;                                                                 \
+    lseek(c->fd, 0, SEEK_SET); K##_save(*l, c->fd);                                   \
+    lseek(c->fd, 0, SEEK_SET);                                                        \
+    if (K##_load(c->fd, &loaded) == LIST_OK) K##_destroy(loaded);                     \
+}                                                                                     \
+static void K##_op_sort(void **l, BenchCtx *c) { K##_sort(*l, NULL); (void)c; }      \
+static void K##_op_sort_copy_rebuild(void **l, BenchCtx *c) { /* referencia: copiar, qsort y reconstruir */ \
+    size_t w; K##_to_array(*l, c->scratch, (size_t)c->count, &w);                     \
+    qsort(c->scratch, w, sizeof(int), bench_compare_int);                             \
+    K##_clear(*l);                                                                    \
+    for (size_t i = 0; i < w; i++) K##_push_back(*l, c->scratch[i]);                  \
+}                                                                                     \
+static void K##_op_clear(void **l, BenchCtx *c) { K##_clear(*l); (void)c; }          \
+static void K##_op_destroy(void **l, BenchCtx *c) { K##_destroy(*l); *l = NULL; (void)c; } \
+static void K##_op_create(void **l, BenchCtx *c) { *l = c->create(); }            \
+static void K##_op_enable_value_index(void **l, BenchCtx *c) { K##_enable_value_index(*l); (void)c; } \
+static void K##_cursor_reset(void **l, BenchCtx *c, T##Cursor *cur) {                 \
+    if (!c->cursor) { c->cursor = cur; K##_cursor_begin(*l, cur); }                   \
+}                                                                                     \
+static void K##_op_cursor_walk(void **l, BenchCtx *c) {                               \
+    static T##Cursor cur; int v;                                                      \
+    K##_cursor_reset(l, c, &cur);                                                     \
+    if (K##_cursor_get(&cur, &v) != LIST_OK) { K##_cursor_begin(*l, &cur); K##_cursor_get(&cur, &v); } \
+    bench_sink += v; K##_cursor_next(&cur);                                           \
+}                                                                                     \
+static void K##_op_cursor_insert_before(void **l, BenchCtx *c) {                      \
+    static T##Cursor cur;                                                             \
+    K##_cursor_reset(l, c, &cur);                                                     \
+    K##_cursor_insert_before(&cur, c->count); K##_cursor_next(&cur); c->count++;      \
+}                                                                                     \
+static void K##_op_cursor_erase(void **l, BenchCtx *c) {                              \
+    static T##Cursor cur; int v;                                                      \
+    K##_cursor_reset(l, c, &cur);                                                     \
+    if (K##_cursor_get(&cur, &v) != LIST_OK) K##_cursor_begin(*l, &cur);              \
+    K##_cursor_erase(&cur); c->count--;                                               \
+}
+
+BENCH_KIND(slist, SList)
+BENCH_KIND(dlist, DList)
+
+static void dlist_op_to_array_reverse(void **l, BenchCtx *c) {
+    size_t w;
+
+    dlist_to_array_reverse(*l, c->scratch, (size_t)c->count, &w);
+    bench_sink += (long long)w;
+}
+
+static void dlist_op_sort_radix(void **l, BenchCtx *c) {
+    dlist_sort_radix(*l, 0);
+    (void)c;
+}
+
+static void dlist_op_par_sum(void **l, BenchCtx *c) {
+    int v;
+
+    dlist_par_sum(*l, 0, &v);
+    bench_sink += v;
+    (void)c;
+}
+
+static void dlist_op_par_contains(void **l, BenchCtx *c) {
+    bool v;
+
+    dlist_par_contains(*l, 0, bench_value(c), &v);
+    bench_sink += v;
+}
+
+static void bench_visit(int value, void *ctx) {
+    __atomic_fetch_add((long long *)ctx, value, __ATOMIC_RELAXED);
+}
+
+static void dlist_op_par_for_each(void **l, BenchCtx *c) {
+    long long v = 0;
+
+    dlist_par_for_each(*l, 0, bench_visit, &v);
+    bench_sink += v;
+    (void)c;
+}
+
+static void slist_op_par_sum(void **l, BenchCtx *c) {
+    int v;
+
+    slist_par_sum(*l, 0, &v);
+    bench_sink += v;
+    (void)c;
+}
+
+static void dlist_op_pop_back(void **l, BenchCtx *c) {
+    int v;
+
+    dlist_pop_back(*l, &v);
+    bench_sink += v;
+    c->count--;
+}
+
+static void dlist_op_cursor_prev(void **l, BenchCtx *c) {
+    static DListCursor cur;
+    int v;
+
+    if (!c->cursor) { // empezamos desde el final
+        c->cursor = &cur;
+        dlist_cursor_begin(*l, &cur);
+        while (dlist_cursor_next(&cur) == LIST_OK) {}
+    }
+
+    if (dlist_cursor_prev(&cur) != LIST_OK) { // volvemos al final
+        while (dlist_cursor_next(&cur) == LIST_OK) {}
+        dlist_cursor_prev(&cur);
+    }
+
+    dlist_cursor_get(&cur, &v);
+    bench_sink += v;
+}
+
+/* XList no tiene extend ni sort: se comparan contra DList las operaciones que comparten. */
+static void xlist_bench_build(void **list, BenchCtx *ctx) {
+    *list = ctx->create();
+    for (int i = 0; i < ctx->size; i++) xlist_push_back(*list, ctx->source[i]);
+}
+
+static void xlist_bench_destroy(void *list) { if (list) xlist_destroy(list); }
+static size_t xlist_bench_bytes(void *list) { size_t b = 0; xlist_size_bytes(list, &b); return b; }
+static void xlist_op_size_bytes(void **l, BenchCtx *c) { size_t v; xlist_size_bytes(*l, &v); bench_sink += (long long)v; (void)c; }
+static void xlist_op_front(void **l, BenchCtx *c) { int v; xlist_front(*l, &v); bench_sink += v; (void)c; }
+static void xlist_op_back(void **l, BenchCtx *c) { int v; xlist_back(*l, &v); bench_sink += v; (void)c; }
+static void xlist_op_contains(void **l, BenchCtx *c) { bool v; xlist_contains(*l, bench_value(c), &v); bench_sink += v; }
+static void xlist_op_search_for_value(void **l, BenchCtx *c) { int v = 0; xlist_search_for_value(*l, bench_value(c), &v); bench_sink += v; }
+static void xlist_op_search_for_position(void **l, BenchCtx *c) { int v; xlist_search_for_position(*l, bench_pos(c, c->count), &v); bench_sink += v; }
+static void xlist_op_change_value(void **l, BenchCtx *c) { int p = bench_pos(c, c->count); xlist_change_value(*l, p - 1, p); }
+static void xlist_op_insert_in_position(void **l, BenchCtx *c) { int p = bench_pos(c, c->count + 1); xlist_insert_in_position(*l, p - 1, p); c->count++; }
+static void xlist_op_free_in_position(void **l, BenchCtx *c) { xlist_free_in_position(*l, bench_pos(c, c->count)); c->count--; }
+static void xlist_op_pop_front(void **l, BenchCtx *c) { int v; xlist_pop_front(*l, &v); bench_sink += v; c->count--; }
+static void xlist_op_pop_back(void **l, BenchCtx *c) { int v; xlist_pop_back(*l, &v); bench_sink += v; c->count--; }
+static void xlist_op_push_back(void **l, BenchCtx *c) { xlist_push_back(*l, c->count++); }
+static void xlist_op_push_front(void **l, BenchCtx *c) { xlist_push_front(*l, c->count++); }
+static void xlist_op_sum(void **l, BenchCtx *c) { int v; xlist_sum(*l, &v); bench_sink += v; (void)c; }
+static void xlist_op_to_array(void **l, BenchCtx *c) { size_t w; xlist_to_array(*l, c->scratch, (size_t)c->count, &w); bench_sink += (long long)w; }
+static void xlist_op_to_array_reverse(void **l, BenchCtx *c) { size_t w; xlist_to_array_reverse(*l, c->scratch, (size_t)c->count, &w); bench_sink += (long long)w; }
+static void xlist_op_clear(void **l, BenchCtx *c) { xlist_clear(*l); (void)c; }
+static void xlist_op_destroy(void **l, BenchCtx *c) { xlist_destroy(*l); *l = NULL; (void)c; }
+
+static void xlist_op_cursor_walk(void **l, BenchCtx *c) {
+    static XListCursor cur;
+    int v;
+
+    if (!c->cursor) {
+        c->cursor = &cur;
+        xlist_cursor_begin(*l, &cur);
+    }
+
+    if (xlist_cursor_get(&cur, &v) != LIST_OK) { // volvemos al inicio
+        xlist_cursor_begin(*l, &cur);
+        xlist_cursor_get(&cur, &v);
+    }
+
+    bench_sink += v;
+    xlist_cursor_next(&cur);
+}
+
+static void xlist_op_cursor_prev(void **l, BenchCtx *c) {
+    static XListCursor cur;
+    int v;
+
+    if (!c->cursor) { // empezamos desde el final
+        c->cursor = &cur;
+        xlist_cursor_begin(*l, &cur);
+        while (xlist_cursor_next(&cur) == LIST_OK) {}
+    }
+
+    if (xlist_cursor_prev(&cur) != LIST_OK) { // volvemos al final
+        while (xlist_cursor_next(&cur) == LIST_OK) {}
+        xlist_cursor_prev(&cur);
+    }
+
+    xlist_cursor_get(&cur, &v);
+    bench_sink += v;
+}
+
+/* ZList solo admite valores ordenados: se construye con ctx->values, que ya lo están. */
+static void zlist_bench_build(void **list, BenchCtx *ctx) {
+    *list = ctx->create();
+    zlist_extend(*list, ctx->source, (size_t)ctx->size);
+}
+
+static void zlist_bench_destroy(void *list) { if (list) zlist_destroy(list); }
+static size_t zlist_bench_bytes(void *list) { size_t b = 0; zlist_size_bytes(list, &b); return b; }
+static void zlist_op_size_bytes(void **l, BenchCtx *c) { size_t v; zlist_size_bytes(*l, &v); bench_sink += (long long)v; (void)c; }
+static void zlist_op_front(void **l, BenchCtx *c) { int v; zlist_front(*l, &v); bench_sink += v; (void)c; }
+static void zlist_op_back(void **l, BenchCtx *c) { int v; zlist_back(*l, &v); bench_sink += v; (void)c; }
+static void zlist_op_contains(void **l, BenchCtx *c) { bool v; zlist_contains(*l, bench_value(c), &v); bench_sink += v; }
+static void zlist_op_search_for_value(void **l, BenchCtx *c) { int v = 0; zlist_search_for_value(*l, bench_value(c), &v); bench_sink += v; }
+static void zlist_op_search_for_position(void **l, BenchCtx *c) { int v; zlist_search_for_position(*l, bench_pos(c, c->count), &v); bench_sink += v; }
+static void zlist_op_push_back(void **l, BenchCtx *c) { zlist_push_back(*l, c->count++); }
+static void zlist_op_sum(void **l, BenchCtx *c) { int v; zlist_sum(*l, &v); bench_sink += v; (void)c; }
+static void zlist_op_to_array(void **l, BenchCtx *c) { size_t w; zlist_to_array(*l, c->scratch, (size_t)c->count, &w); bench_sink += (long long)w; }
+static void zlist_op_clear(void **l, BenchCtx *c) { zlist_clear(*l); (void)c; }
+static void zlist_op_destroy(void **l, BenchCtx *c) { zlist_destroy(*l); *l = NULL; (void)c; }
+
+static void zlist_op_cursor_walk(void **l, BenchCtx *c) {
+    static ZListCursor cur;
+    int v;
+
+    if (!c->cursor) {
+        c->cursor = &cur;
+        zlist_cursor_begin(*l, &cur);
+    }
+
+    if (zlist_cursor_get(&cur, &v) != LIST_OK) { // volvemos al inicio
+        zlist_cursor_begin(*l, &cur);
+        zlist_cursor_get(&cur, &v);
+    }
+
+    bench_sink += v;
+    zlist_cursor_next(&cur);
+}
+
+#define ALL (PATTERN_SEQ | PATTERN_RANDOM | PATTERN_TAIL)
+#define SEQ PATTERN_SEQ
+
+#define BENCH_COMMON_OPS(K)                                                   \
+    {"create", K##_op_create, SEQ, 0, 1, 1},                                  \
+    {"size", K##_op_size, SEQ, 0, 0, 1},                                      \
+    {"size_bytes", K##_op_size_bytes, SEQ, 0, 0, 1},                          \
+    {"is_empty", K##_op_is_empty, SEQ, 0, 0, 1},                              \
+    {"front", K##_op_front, SEQ, 0, 0, 1},                                    \
+    {"back", K##_op_back, SEQ, 0, 0, 1},                                      \
+    {"contains", K##_op_contains, ALL, 0, 0, 1},                              \
+    {"search_for_value", K##_op_search_for_value, ALL, 0, 0, 1},              \
+    {"search_for_position", K##_op_search_for_position, ALL, 0, 0, 1},        \
+    {"change_value", K##_op_change_value, ALL, 0, 0, 1},                      \
+    {"insert_in_position", K##_op_insert_in_position, ALL, 1, 0, 1},          \
+    {"free_in_position", K##_op_free_in_position, ALL, -1, 0, 1},             \
+    {"pop_front", K##_op_pop_front, SEQ, -1, 0, 1},                           \
+    {"pop_front_n", K##_op_pop_front_n, SEQ, -8, 0, 8},                       \
+    {"push_back", K##_op_push_back, SEQ, 1, 0, 1},                            \
+    {"push_front", K##_op_push_front, SEQ, 1, 0, 1},                          \
+    {"sum", K##_op_sum, SEQ, 0, 0, WHOLE},                                    \
+    {"sum64", K##_op_sum64, SEQ, 0, 0, WHOLE},                                \
+    {"min", K##_op_min, SEQ, 0, 0, WHOLE},                                    \
+    {"max", K##_op_max, SEQ, 0, 0, WHOLE},                                    \
+    {"minmax", K##_op_minmax, SEQ, 0, 0, WHOLE},                              \
+    {"count_if_equal", K##_op_count_if_equal, ALL, 0, 0, WHOLE},              \
+    {"aggregate", K##_op_aggregate, SEQ, 0, 0, WHOLE},                        \
+    {"to_array", K##_op_to_array, SEQ, 0, 0, WHOLE},                          \
+    {"extend", K##_op_extend, SEQ, 0, 1, WHOLE},                              \
+    {"extend_front", K##_op_extend_front, SEQ, 0, 1, WHOLE},                  \
+    {"enable_value_index", K##_op_enable_value_index, SEQ, 0, 1, WHOLE},      \
+    {"remove_if", K##_op_remove_if, SEQ, 0, 1, WHOLE},                        \
+    {"remove_value", K##_op_remove_value, ALL, -1, 0, 1},                     \
+    {"remove_range", K##_op_remove_range, ALL, -8, 0, 8},                     \
+    {"split_concat", K##_op_split_concat, ALL, 0, 0, 1},                      \
+    {"save_load", K##_op_save_load, SEQ, 0, 0, WHOLE},                        \
+    {"sort", K##_op_sort, SEQ | PATTERN_RANDOM, 0, 1, WHOLE},                 \
+    {"sort_copy_rebuild", K##_op_sort_copy_rebuild, SEQ | PATTERN_RANDOM, 0, 1, WHOLE}, \
+    {"clear", K##_op_clear, SEQ, 0, 1, WHOLE},                                \
+    {"destroy", K##_op_destroy, SEQ, 0, 1, WHOLE},                            \
+    {"cursor_walk", K##_op_cursor_walk, SEQ, 0, 0, 1},                        \
+    {"cursor_insert_before", K##_op_cursor_insert_before, SEQ, 1, 0, 1},      \
+    {"cursor_erase", K##_op_cursor_erase, SEQ, -1, 0, 1}
+
+static const BenchOp slist_ops[] = {
+    BENCH_COMMON_OPS(slist),
+    {"par_sum", slist_op_par_sum, SEQ, 0, 0, WHOLE},
+    {NULL, NULL, 0, 0, 0, 0}
+};
+
+static const BenchOp dlist_ops[] = {
+    BENCH_COMMON_OPS(dlist),
+    {"pop_back", dlist_op_pop_back, SEQ, -1, 0, 1},
+    {"sort_radix", dlist_op_sort_radix, SEQ | PATTERN_RANDOM, 0, 1, WHOLE},
+    {"to_array_reverse", dlist_op_to_array_reverse, SEQ, 0, 0, WHOLE},
+    {"par_sum", dlist_op_par_sum, SEQ, 0, 0, WHOLE},
+    {"par_contains", dlist_op_par_contains, ALL, 0, 0, WHOLE},
+    {"par_for_each", dlist_op_par_for_each, SEQ, 0, 0, WHOLE},
+    {"cursor_prev", dlist_op_cursor_prev, SEQ, 0, 0, 1},
+    {NULL, NULL, 0, 0, 0, 0}
+};
+
+static const BenchOp xlist_ops[] = {
+    {"size_bytes", xlist_op_size_bytes, SEQ, 0, 0, 1},
+    {"front", xlist_op_front, SEQ, 0, 0, 1},
+    {"back", xlist_op_back, SEQ, 0, 0, 1},
+    {"contains", xlist_op_contains, ALL, 0, 0, 1},
+    {"search_for_value", xlist_op_search_for_value, ALL, 0, 0, 1},
+    {"search_for_position", xlist_op_search_for_position, ALL, 0, 0, 1},
+    {"change_value", xlist_op_change_value, ALL, 0, 0, 1},
+    {"insert_in_position", xlist_op_insert_in_position, ALL, 1, 0, 1},
+    {"free_in_position", xlist_op_free_in_position, ALL, -1, 0, 1},
+    {"pop_front", xlist_op_pop_front, SEQ, -1, 0, 1},
+    {"pop_back", xlist_op_pop_back, SEQ, -1, 0, 1},
+    {"push_back", xlist_op_push_back, SEQ, 1, 0, 1},
+    {"push_front", xlist_op_push_front, SEQ, 1, 0, 1},
+    {"sum", xlist_op_sum, SEQ, 0, 0, WHOLE},
+    {"to_array", xlist_op_to_array, SEQ, 0, 0, WHOLE},
+    {"to_array_reverse", xlist_op_to_array_reverse, SEQ, 0, 0, WHOLE},
+    {"clear", xlist_op_clear, SEQ, 0, 1, WHOLE},
+    {"destroy", xlist_op_destroy, SEQ, 0, 1, WHOLE},
+    {"cursor_walk", xlist_op_cursor_walk, SEQ, 0, 0, 1},
+    {"cursor_prev", xlist_op_cursor_prev, SEQ, 0, 0, 1},
+    {NULL, NULL, 0, 0, 0, 0}
+};
+
+static const BenchOp zlist_ops[] = {
+    {"size_bytes", zlist_op_size_bytes, SEQ, 0, 0, 1},
+    {"front", zlist_op_front, SEQ, 0, 0, 1},
+    {"back", zlist_op_back, SEQ, 0, 0, 1},
+    {"contains", zlist_op_contains, ALL, 0, 0, 1},
+    {"search_for_value", zlist_op_search_for_value, ALL, 0, 0, 1},
+    {"search_for_position", zlist_op_search_for_position, ALL, 0, 0, 1},
+    {"push_back", zlist_op_push_back, SEQ, 1, 0, 1},
+    {"sum", zlist_op_sum, SEQ, 0, 0, WHOLE},
+    {"to_array", zlist_op_to_array, SEQ, 0, 0, WHOLE},
+    {"clear", zlist_op_clear, SEQ, 0, 1, WHOLE},
+    {"destroy", zlist_op_destroy, SEQ, 0, 1, WHOLE},
+    {"cursor_walk", zlist_op_cursor_walk, SEQ, 0, 0, 1},
+    {NULL, NULL, 0, 0, 0, 0}
+};
+
+static void *bench_slist_create(void) { return slist_create(); }
+static void *bench_slist_pooled(void) { return slist_create_pooled(0); }
+static void *bench_slist_hashed(void) { SList *l = slist_create(); slist_enable_value_index(l); return l; }
+static void *bench_dlist_create(void) { return dlist_create(); }
+static void *bench_dlist_pooled(void) { return dlist_create_pooled(0); }
+static void *bench_dlist_indexed(void) { return dlist_create_indexed(); }
+static void *bench_dlist_hashed(void) { DList *l = dlist_create(); dlist_enable_value_index(l); return l; }
+static void *bench_xlist_create(void) { return xlist_create(); }
+static void *bench_zlist_create(void) { return zlist_create(); }
+
+static const BenchVariant variants[] = {
+    {"slist", bench_slist_create, slist_bench_build, slist_bench_destroy, slist_bench_bytes, slist_ops, 1},
+    {"slist_pooled", bench_slist_pooled, slist_bench_build, slist_bench_destroy, slist_bench_bytes, slist_ops, 0},
+    {"slist_hashed", bench_slist_hashed, slist_bench_build, slist_bench_destroy, slist_bench_bytes, slist_ops, 0},
+    {"dlist", bench_dlist_create, dlist_bench_build, dlist_bench_destroy, dlist_bench_bytes, dlist_ops, 1},
+    {"dlist_pooled", bench_dlist_pooled, dlist_bench_build, dlist_bench_destroy, dlist_bench_bytes, dlist_ops, 0},
+    {"dlist_indexed", bench_dlist_indexed, dlist_bench_build, dlist_bench_destroy, dlist_bench_bytes, dlist_ops, 0},
+    {"dlist_hashed", bench_dlist_hashed, dlist_bench_build, dlist_bench_destroy, dlist_bench_bytes, dlist_ops, 0},
+    {"xlist", bench_xlist_create, xlist_bench_build, xlist_bench_destroy, xlist_bench_bytes, xlist_ops, 0},
+    {"zlist", bench_zlist_create, zlist_bench_build, zlist_bench_destroy, zlist_bench_bytes, zlist_ops, 0},
+};
+
+static const char *pattern_name(Pattern pattern) {
+    switch (pattern) {
+        case PATTERN_RANDOM: return "random";
+        case PATTERN_TAIL: return "tail";
+        default: return "seq";
+    }
+}
+
+typedef struct BenchResult {
+    long long ops;
+    double ns_per_op;
+} BenchResult;
+
+static BenchResult bench_case(const BenchVariant *variant, const BenchOp *op, BenchCtx *ctx, double min_ns) {
+    BenchResult result = {0, 0.0};
+    void *list = NULL;
+    long long max_ops = 1000000000LL;
+    double total = 0.0;
+
+    ctx->count = ctx->size;
+    ctx->next_pos = 1;
+    ctx->seed = 2463534242u;
+    ctx->cursor = NULL;
+    // en las operaciones de lista completa, random construye la lista con valores permutados
+    ctx->source = (op->fresh && ctx->pattern == PATTERN_RANDOM) ? ctx->shuffled : ctx->values;
+
+    if (op->delta > 0) max_ops = ctx->size; // la lista crece como mucho al doble
+    if (op->delta < 0) max_ops = ctx->size / 2 / -op->delta; // la lista nunca se vacía
+    if (max_ops < 1) max_ops = 1;
+
+    if (op->fresh) { // una lista nueva por operación, construida fuera del tiempo medido
+        while (total < min_ns && result.ops < max_ops) {
+            if (strcmp(op->name, "create") != 0) variant->build(&list, ctx); // create parte de nada
+
+            double start = bench_now();
+            op->run(&list, ctx);
+            double elapsed = bench_now() - start;
+
+            total += elapsed;
+            result.ops++;
+            variant->destroy(list);
+            list = NULL;
+        }
+    } else {
+        long long batch = 1;
+
+        variant->build(&list, ctx);
+
+        while (total < min_ns && result.ops < max_ops) {
+            if (batch > max_ops - result.ops) batch = max_ops - result.ops;
+
+            double start = bench_now();
+            for (long long i = 0; i < batch; i++) {
+                op->run(&list, ctx);
+            }
+            total += bench_now() - start;
+            result.ops += batch;
+
+            if (batch < (1 << 20)) batch *= 2;
+        }
+
+        variant->destroy(list);
+    }
+
+    result.ns_per_op = result.ops ? total / (double)result.ops : 0.0;
+    return result;
+}
+
+static void usage(const char *program) {
+    fprintf(stderr, "uso: %s [--format csv|json] [--max-size N] [--min-time-ms MS] [--variants basic|all] [--op NOMBRE] [--memory]\n", program);
+}
+
+int main(int argc, char *argv[]) {
+    const char *format = "csv";
+    const char *only_op = NULL;
+    int max_size = 10000000;
+    double min_ms = 100.0;
+    int all_variants = 0;
+    int memory = 0;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--format") && i + 1 < argc) {
+            format = argv[++i];
+        } else if (!strcmp(argv[i], "--max-size") && i + 1 < argc) {
+            max_size = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--min-time-ms") && i + 1 < argc) {
+            min_ms = atof(argv[++i]);
+        } else if (!strcmp(argv[i], "--variants") && i + 1 < argc) {
+            all_variants = !strcmp(argv[++i], "all");
+        } else if (!strcmp(argv[i], "--op") && i + 1 < argc) {
+            only_op = argv[++i];
+        } else if (!strcmp(argv[i], "--memory")) {
+            memory = 1;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    int json = !strcmp(format, "json");
+    int first_row = 1;
+    int *values = malloc((size_t)max_size * sizeof(int) + sizeof(int));
+    int *shuffled = malloc((size_t)max_size * sizeof(int) + sizeof(int));
+    int *scratch = malloc(2 * (size_t)max_size * sizeof(int) + sizeof(int)); // cabe la lista al doble
+
+    FILE *snapshot = tmpfile(); // destino de save_load
+
+    if (!values || !shuffled || !scratch) {
+        fprintf(stderr, "sin memoria para los búferes\n");
+        return 1;
+    }
+    if (!snapshot) {
+        fprintf(stderr, "no se pudo crear el archivo temporal\n");
+        return 1;
+    }
+
+    unsigned seed = 2463534242u;
+
+    for (int i = 0; i < max_size; i++) {
+        values[i] = i; // value == pos - 1
+        shuffled[i] = i;
+    }
+
+    for (int i = max_size - 1; i > 0; i--) { // Fisher-Yates con xorshift32
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+
+        int j = (int)(seed % (unsigned)(i + 1));
+        int tmp = shuffled[i];
+        shuffled[i] = shuffled[j];
+        shuffled[j] = tmp;
+    }
+
+    if (json) printf("[\n");
+    else if (memory) printf("variant,size,bytes,bytes_per_element\n");
+    else printf("variant,op,pattern,size,ops,ns_per_op,ops_per_sec,elements_per_op\n");
+
+    for (size_t v = 0; memory && v < sizeof(variants) / sizeof(variants[0]); v++) {
+        const BenchVariant *variant = &variants[v];
+        if (!all_variants && !variant->basic) continue;
+
+        for (int size = 100; size <= max_size; size *= 10) {
+            BenchCtx ctx;
+            void *list;
+
+            ctx.size = size;
+            ctx.source = values;
+            ctx.create = variant->create;
+            variant->build(&list, &ctx);
+
+            size_t bytes = variant->bytes(list);
+
+            if (json) {
+                printf("%s  {\"variant\": \"%s\", \"size\": %d, \"bytes\": %zu, \"bytes_per_element\": %.2f}",
+                       first_row ? "" : ",\n", variant->name, size, bytes, bytes / (double)size);
+            } else {
+                printf("%s,%d,%zu,%.2f\n", variant->name, size, bytes, bytes / (double)size);
+            }
+
+            first_row = 0;
+            variant->destroy(list);
+        }
+    }
+
+
+    for (size_t v = 0; !memory && v < sizeof(variants) / sizeof(variants[0]); v++) {
+        const BenchVariant *variant = &variants[v];
+        if (!all_variants && !variant->basic) continue;
+
+        for (int size = 100; size <= max_size; size *= 10) {
+            for (const BenchOp *op = variant->ops; op->name; op++) {
+                if (only_op && strcmp(only_op, op->name) != 0) continue;
+
+                for (unsigned p = PATTERN_SEQ; p <= PATTERN_TAIL; p <<= 1) {
+                    if (!(op->patterns & p)) continue;
+
+                    BenchCtx ctx;
+                    ctx.size = size;
+                    ctx.pattern = (Pattern)p;
+                    ctx.values = values;
+                    ctx.shuffled = shuffled;
+                    ctx.scratch = scratch;
+                    ctx.fd = fileno(snapshot);
+                    ctx.create = variant->create;
+
+                    BenchResult r = bench_case(variant, op, &ctx, min_ms * 1e6);
+                    double ops_per_sec = r.ns_per_op > 0 ? 1e9 / r.ns_per_op : 0.0;
+                    int elements = op->elements == WHOLE ? size : op->elements;
+
+                    if (json) {
+                        printf("%s  {\"variant\": \"%s\", \"op\": \"%s\", \"pattern\": \"%s\", \"size\": %d, "
+                               "\"ops\": %lld, \"ns_per_op\": %.2f, \"ops_per_sec\": %.2f, \"elements_per_op\": %d}",
+                               first_row ? "" : ",\n", variant->name, op->name, pattern_name((Pattern)p),
+                               size, r.ops, r.ns_per_op, ops_per_sec, elements);
+                    } else {
+                        printf("%s,%s,%s,%d,%lld,%.2f,%.2f,%d\n", variant->name, op->name,
+                               pattern_name((Pattern)p), size, r.ops, r.ns_per_op, ops_per_sec, elements);
+                    }
+
+                    first_row = 0;
+                    fflush(stdout);
+                }
+            }
+        }
+    }
+
+    if (json) printf("\n]\n");
+
+    free(values);
+    free(shuffled);
+    free(scratch);
+    fclose(snapshot);
+    return 0;
+}
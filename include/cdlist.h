@@ -0,0 +1,221 @@
+#ifndef CDLIST_H
+#define CDLIST_H
+
+#include "list_status.h"
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Lista doblemente enlazada concurrente con un candado por nodo. Las
+ * operaciones recorren la lista de head hacia tail tomando el candado del
+ * siguiente nodo antes de soltar el del actual (acoplamiento de candados),
+ * así que dos hilos que trabajan en regiones distintas de la lista avanzan
+ * en paralelo. head y tail son nodos centinela que nunca se eliminan, de
+ * modo que insertar o eliminar en los extremos es un caso más, y como todos
+ * los candados se toman en el mismo sentido no hay interbloqueos.
+ *
+ * Las posiciones siguen la convención de dlist.h; con otros hilos
+ * modificando la lista, una posición se refiere al momento en que la
+ * operación llega a ella. Hasta EPOCH_MAX_THREADS (256) hilos vivos pueden
+ * usar estructuras concurrentes a la vez; las operaciones de un hilo más
+ * que lo necesitan devuelven LIST_ERR_ALLOC.
+ */
+typedef struct CDList CDList;
+
+/**
+ * @brief Crea una lista concurrente vacía.
+ *
+ * @return
+ * - Puntero a la lista si se creó correctamente
+ * - NULL si falla malloc
+ */
+CDList *cdlist_create(void);
+
+/**
+ * @brief Obtiene el número de elementos en la lista.
+ *
+ * El contador se actualiza después de cada operación sin sincronizarse con
+ * ella: con otros hilos modificando la lista el resultado es aproximado.
+ *
+ * @param list Lista válida
+ * @param count Puntero donde se almacena el número de elementos
+ *
+ * @return
+ * - LIST_OK si se obtuvo el número de elementos correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus cdlist_size(CDList *list, int *count);
+
+/**
+ * @brief Determina si la lista está vacía en el momento de la llamada.
+ *
+ * @param list Lista válida
+ * @param is_empty Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si se determinó el resultado
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus cdlist_is_empty(CDList *list, bool *is_empty);
+
+/**
+ * @brief Busca un elemento en la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a buscar
+ * @param found Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró o no
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus cdlist_contains(CDList *list, int value, bool *found);
+
+/**
+ * @brief Inserta un elemento al final de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_ALLOC si malloc falla o ya hay EPOCH_MAX_THREADS hilos registrados
+ */
+ListStatus cdlist_push_back(CDList *list, int value);
+
+/**
+ * @brief Inserta un elemento al inicio de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus cdlist_push_front(CDList *list, int value);
+
+/**
+ * @brief Inserta un elemento en cualquier posición válida de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ * @param pos Posición en la que se inserta
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus cdlist_insert_in_position(CDList *list, int value, int pos);
+
+/**
+ * @brief Reemplaza un elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento por reemplazar
+ * @param pos Posición del elemento a reemplazar
+ *
+ * @return
+ * - LIST_OK si se reemplazó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus cdlist_change_value(CDList *list, int value, int pos);
+
+/**
+ * @brief Devuelve el elemento en la posición solicitada
+ *
+ * @param list Lista válida
+ * @param pos Posición solicitada
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus cdlist_search_for_position(CDList *list, int pos, int *value);
+
+/**
+ * @brief Elimina un elemento de la lista en cualquier posición.
+ *
+ * @param list Lista válida
+ * @param pos Posición del elemento a liberar
+ *
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus cdlist_free_in_position(CDList *list, int pos);
+
+/**
+ * @brief Elimina el primer elemento de la lista y lo devuelve.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ *
+ * @return
+ * - LIST_OK si se eliminó el elemento correctamente
+ * - LIST_ERR_NULL si la lista o value no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus cdlist_pop_front(CDList *list, int *value);
+
+/**
+ * @brief Elimina el último elemento de la lista y lo devuelve.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ *
+ * @return
+ * - LIST_OK si se eliminó el elemento correctamente
+ * - LIST_ERR_NULL si la lista o value no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_ALLOC si ya hay EPOCH_MAX_THREADS hilos registrados
+ */
+ListStatus cdlist_pop_back(CDList *list, int *value);
+
+/**
+ * @brief Suma todos los elementos de la lista.
+ *
+ * @param list Lista válida
+ * @param sum Puntero donde se almacena la suma
+ *
+ * @return
+ * - LIST_OK si la suma se hizo correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus cdlist_sum(CDList *list, int *sum);
+
+/**
+ * @brief Destruye toda la lista.
+ *
+ * Ningún otro hilo debe estar usando la lista.
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si la lista se destruyó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus cdlist_destroy(CDList *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CDLIST_H */
@@ -0,0 +1,119 @@
+#ifndef CSLIST_H
+#define CSLIST_H
+
+#include "list_status.h"
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Pila concurrente sin bloqueos (pila de Treiber): varios hilos pueden
+ * llamar a cslist_push_front y cslist_pop_front a la vez sin un mutex.
+ * head se actualiza con un solo CAS de 64 bits que junta el índice del nodo
+ * y un contador de versión, de modo que un nodo que se saca y se vuelve a
+ * meter entre la lectura y el CAS de otro hilo no lo engaña (problema ABA).
+ *
+ * Los nodos sacados se reutilizan pero nunca se liberan mientras la lista
+ * existe, así que un hilo que aún lee un nodo ya sacado no toca memoria
+ * liberada. Toda la memoria se libera en cslist_destroy, que no debe
+ * llamarse mientras otro hilo use la lista.
+ */
+typedef struct CSList CSList;
+
+/**
+ * @brief Crea una pila concurrente.
+ *
+ * @return
+ * - Puntero a la lista si se creó correctamente
+ * - NULL si falla malloc
+ */
+CSList *cslist_create(void);
+
+/**
+ * @brief Obtiene el número de elementos en la lista.
+ *
+ * El contador se actualiza después de cada operación sin sincronizarse con
+ * ella: con otros hilos modificando la lista el resultado es aproximado.
+ *
+ * @param list Lista válida
+ * @param count Puntero donde se almacena el número de elementos
+ *
+ * @return
+ * - LIST_OK si se obtuvo el número de elementos correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus cslist_size(CSList *list, int *count);
+
+/**
+ * @brief Obtiene el tamaño de la lista en bytes (manejador y nodos reservados).
+ *
+ * @param list Lista válida
+ * @param bytes Puntero donde se almacena el número de bytes
+ *
+ * @return
+ * - LIST_OK si se obtuvo el tamaño en bytes
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus cslist_size_bytes(CSList *list, size_t *bytes);
+
+/**
+ * @brief Determina si la lista está vacía en el momento de la llamada.
+ *
+ * @param list Lista válida
+ * @param is_empty Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si se determinó el resultado
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus cslist_is_empty(CSList *list, bool *is_empty);
+
+/**
+ * @brief Inserta un elemento al inicio de la lista. Se puede llamar desde varios hilos a la vez.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_OUT_OF_RANGE si la lista ya tiene INT_MAX nodos reservados
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus cslist_push_front(CSList *list, int value);
+
+/**
+ * @brief Elimina el primer elemento de la lista y lo devuelve. Se puede llamar desde varios hilos a la vez.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ *
+ * @return
+ * - LIST_OK si se eliminó el elemento correctamente
+ * - LIST_ERR_NULL si la lista o value no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus cslist_pop_front(CSList *list, int *value);
+
+/**
+ * @brief Destruye toda la lista.
+ *
+ * Ningún otro hilo debe estar usando la lista.
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si la lista se destruyó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus cslist_destroy(CSList *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CSLIST_H */
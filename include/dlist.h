@@ -1,6 +1,8 @@
 #ifndef DLIST_H
 #define DLIST_H
 
+#include "list_aggregate.h"
+#include "list_callbacks.h"
 #include "list_status.h"
 
 #include <stddef.h>
@@ -12,6 +14,18 @@ extern "C" {
 
 typedef struct DList DList;
 
+/**
+ * @brief Cursor para recorrer y modificar una lista en O(1) por paso.
+ * 
+ * Sus campos son internos y no deben modificarse directamente. Cualquier
+ * cambio en la lista que no se haga a través del cursor lo invalida.
+ */
+typedef struct DListCursor {
+    DList *list; /**< Lista recorrida */
+    void *node; /**< Nodo actual, NULL al final de la lista (uso interno) */
+    int pos; /**< Posición del nodo actual (uso interno) */
+} DListCursor;
+
 /**
  * @brief Crea una lista doblemente enlazada.
  * 
@@ -21,6 +35,53 @@ typedef struct DList DList;
  */
 DList *dlist_create(void);
 
+/**
+ * @brief Crea una lista doblemente enlazada cuyos nodos se reservan por bloques.
+ * 
+ * Los nodos se toman de slabs de block_nodes nodos, los nodos liberados se
+ * reutilizan y dlist_clear libera la memoria en O(número de slabs).
+ * 
+ * @param block_nodes Número de nodos por slab (0 usa el valor por defecto)
+ * 
+ * @return
+ * - Puntero a la lista si se creó correctamente
+ * - NULL si falla malloc
+ */
+DList *dlist_create_pooled(size_t block_nodes);
+
+/**
+ * @brief Crea una lista doblemente enlazada indexada por posición.
+ * 
+ * La lista mantiene carriles exprés de tipo skip list sobre sus nodos, con el
+ * ancho de cada salto, de modo que dlist_search_for_position,
+ * dlist_insert_in_position, dlist_change_value y dlist_free_in_position
+ * cuestan O(log n) esperado. El resto de la API no cambia.
+ * 
+ * @return
+ * - Puntero a la lista si se creó correctamente
+ * - NULL si falla malloc
+ */
+DList *dlist_create_indexed(void);
+
+/**
+ * @brief Activa un índice hash por valor sobre la lista.
+ * 
+ * El índice se construye con los elementos actuales y se mantiene en cada
+ * inserción, cambio y eliminación. Con él dlist_contains y
+ * dlist_count_if_equal cuestan O(1) esperado, y dlist_search_for_value
+ * responde LIST_ERR_NOT_FOUND sin recorrer la lista. Su memoria se incluye
+ * en dlist_size_bytes. Si más adelante falla una reserva del índice, este
+ * se descarta y la lista sigue funcionando sin él.
+ * 
+ * @param list Lista válida
+ * 
+ * @return
+ * - LIST_OK si el índice quedó activo
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus dlist_enable_value_index(DList *list);
+
 /**
  * @brief Obtiene el número de elementos en la lista.
  * 
@@ -97,6 +158,43 @@ ListStatus dlist_push_back(DList *list, int value);
  */
 ListStatus dlist_push_front(DList *list, int value);
 
+/**
+ * @brief Inserta n elementos al final de la lista, en el mismo orden.
+ * 
+ * Los nodos se enlazan entre sí antes de unirse a la lista, así que si falla
+ * una reserva la lista no cambia. En una lista con pool los n nodos se
+ * reservan en un único bloque.
+ * 
+ * @param list Lista válida
+ * @param values Arreglo con los elementos a insertar
+ * @param n Número de elementos en values
+ * 
+ * @return
+ * - LIST_OK si se insertaron los elementos correctamente
+ * - LIST_ERR_NULL si la lista o values no existen
+ * - LIST_ERR_OUT_OF_RANGE si la lista superaría INT_MAX elementos
+ * - LIST_ERR_ALLOC si malloc falla (no se inserta ningún elemento)
+ */
+ListStatus dlist_extend(DList *list, const int *values, size_t n);
+
+/**
+ * @brief Inserta n elementos al inicio de la lista, en el mismo orden.
+ * 
+ * values[0] queda como primer elemento de la lista. Igual que
+ * dlist_extend, la operación es atómica si falla la reserva.
+ * 
+ * @param list Lista válida
+ * @param values Arreglo con los elementos a insertar
+ * @param n Número de elementos en values
+ * 
+ * @return
+ * - LIST_OK si se insertaron los elementos correctamente
+ * - LIST_ERR_NULL si la lista o values no existen
+ * - LIST_ERR_OUT_OF_RANGE si la lista superaría INT_MAX elementos
+ * - LIST_ERR_ALLOC si malloc falla (no se inserta ningún elemento)
+ */
+ListStatus dlist_extend_front(DList *list, const int *values, size_t n);
+
 /**
  * @brief Inserta un elemento en cualquier posición válida de la lista.
  * 
@@ -144,6 +242,10 @@ ListStatus dlist_search_for_value(DList *list, int value, int *pos);
 /**
  * @brief Devuelve el elemento en la posición solicitada
  * 
+ * Los accesos por posición parten del extremo más cercano o de la última
+ * posición accedida, por lo que recorrer la lista en orden cuesta O(1) por
+ * llamada.
+ * 
  * @param list Lista válida
  * @param pos Posición solicitada
  * @param value Puntero donde se almacena el elemento
@@ -196,6 +298,157 @@ ListStatus dlist_back(DList *list, int *value);
  */
 ListStatus dlist_free_in_position(DList *list, int pos);
 
+/**
+ * @brief Elimina el primer elemento de la lista y lo devuelve en O(1).
+ * 
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ * 
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_pop_front(DList *list, int *value);
+
+/**
+ * @brief Elimina el último elemento de la lista y lo devuelve en O(1).
+ * 
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ * 
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_pop_back(DList *list, int *value);
+
+/**
+ * @brief Elimina los primeros n elementos de la lista en O(n).
+ * 
+ * Los valores se copian en out en el orden de la lista. Si la lista tiene
+ * menos de n elementos no se elimina ninguno.
+ * 
+ * @param list Lista válida
+ * @param out Arreglo con espacio para n enteros (NULL para descartarlos)
+ * @param n Número de elementos a eliminar
+ * 
+ * @return
+ * - LIST_OK si los elementos se eliminaron correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE si la lista tiene menos de n elementos
+ */
+ListStatus dlist_pop_front_n(DList *list, int *out, size_t n);
+
+/**
+ * @brief Elimina en un solo recorrido todos los elementos que cumplen pred.
+ * 
+ * @param list Lista válida
+ * @param pred Condición de los elementos a eliminar
+ * @param ctx Contexto que se pasa a pred (puede ser NULL)
+ * @param removed Puntero donde se almacena cuántos se eliminaron (puede ser NULL)
+ * 
+ * @return
+ * - LIST_OK si el recorrido terminó (aunque no se eliminara ninguno)
+ * - LIST_ERR_NULL si la lista o pred no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_remove_if(DList *list, ListPredicate pred, void *ctx, size_t *removed);
+
+/**
+ * @brief Elimina en un solo recorrido todas las apariciones de value.
+ * 
+ * Con índice por valor el recorrido termina en cuanto se eliminó la última
+ * aparición, y no se recorre nada si value no está.
+ * 
+ * @param list Lista válida
+ * @param value Elemento a eliminar
+ * @param removed Puntero donde se almacena cuántos se eliminaron (puede ser NULL)
+ * 
+ * @return
+ * - LIST_OK si el recorrido terminó (aunque no se eliminara ninguno)
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_remove_value(DList *list, int value, size_t *removed);
+
+/**
+ * @brief Elimina los elementos de las posiciones from a to (incluida).
+ * 
+ * @param list Lista válida
+ * @param from Posición del primer elemento a eliminar
+ * @param to Posición del último elemento a eliminar
+ * 
+ * @return
+ * - LIST_OK si los elementos se eliminaron correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE si alguna posición está fuera de rango o from > to
+ */
+ListStatus dlist_remove_range(DList *list, int from, int to);
+
+/**
+ * @brief Mueve todos los elementos de src al final de dst.
+ * 
+ * Si ninguna de las dos listas usa pool los nodos se reenlazan en O(1), sin
+ * reservar ni copiar (más O(n) si alguna tiene índice por valor); con pool
+ * los valores se copian a nodos de dst. src queda vacía, pero sigue siendo
+ * válida.
+ * 
+ * @param dst Lista que recibe los elementos
+ * @param src Lista que entrega los elementos
+ * 
+ * @return
+ * - LIST_OK si los elementos se movieron correctamente
+ * - LIST_ERR_NULL si alguna lista no existe o no fue creada
+ * - LIST_ERR_OUT_OF_RANGE si dst y src son la misma lista o el total no cabe en un int
+ * - LIST_ERR_ALLOC si falla malloc al copiar (ninguna lista cambia)
+ */
+ListStatus dlist_concat(DList *dst, DList *src);
+
+/**
+ * @brief Mueve los elementos from..to de src a dst, a partir de la posición pos.
+ * 
+ * Los nodos se reenlazan sin reservar ni copiar si ninguna de las dos listas
+ * usa pool; con pool los valores se copian a nodos de dst. Tras la llamada el
+ * elemento que ocupaba from en src ocupa pos en dst.
+ * 
+ * @param dst Lista que recibe los elementos
+ * @param pos Posición de dst donde queda el primer elemento movido (1 a tamaño + 1)
+ * @param src Lista que entrega los elementos
+ * @param from Posición del primer elemento a mover
+ * @param to Posición del último elemento a mover (incluida)
+ * 
+ * @return
+ * - LIST_OK si los elementos se movieron correctamente
+ * - LIST_ERR_NULL si alguna lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si src está vacía
+ * - LIST_ERR_OUT_OF_RANGE si alguna posición está fuera de rango, from > to o dst y src son la misma lista
+ * - LIST_ERR_ALLOC si falla malloc al copiar (ninguna lista cambia)
+ */
+ListStatus dlist_splice(DList *dst, int pos, DList *src, int from, int to);
+
+/**
+ * @brief Parte la lista en dos: los elementos desde pos pasan a una lista nueva.
+ * 
+ * La lista nueva se crea con la misma configuración (pool, índices) que list.
+ * Sin pool los nodos se reenlazan sin reservar ni copiar; con pool los valores
+ * se copian al pool de la lista nueva.
+ * 
+ * @param list Lista válida; conserva las posiciones 1 a pos - 1
+ * @param pos Primera posición que pasa a la lista nueva (1 a tamaño + 1)
+ * @param out_tail Puntero donde se devuelve la lista nueva (vacía si pos es tamaño + 1)
+ * 
+ * @return
+ * - LIST_OK si la lista se partió correctamente
+ * - LIST_ERR_NULL si la lista no existe o out_tail es NULL
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ * - LIST_ERR_ALLOC si falla malloc (list no cambia)
+ */
+ListStatus dlist_split_at(DList *list, int pos, DList **out_tail);
+
 /**
  * @brief Vacía toda la lista.
  * 
@@ -208,6 +461,47 @@ ListStatus dlist_free_in_position(DList *list, int pos);
  */
 ListStatus dlist_clear(DList *list);
 
+/**
+ * @brief Ordena la lista en O(n log n).
+ * 
+ * Merge sort ascendente (bottom-up) y estable. No reserva memoria en el
+ * heap; usa un búfer fijo de 4 KB en la pila. Cada tramo de 512 nodos
+ * consecutivos se ordena copiando sus valores al búfer y escribiéndolos de
+ * vuelta en los mismos nodos, así que un nodo puede terminar con otro valor;
+ * después los tramos se mezclan reenlazando nodos. Se corrigen tail y prev. Los cursores de la
+ * lista quedan invalidados y no debe suponerse que un valor sigue en el
+ * mismo nodo.
+ * 
+ * @param list Lista válida
+ * @param cmp Función de comparación (NULL para orden ascendente)
+ * 
+ * @return
+ * - LIST_OK si la lista se ordenó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_sort(DList *list, ListCompare cmp);
+
+/**
+ * @brief Ordena la lista de menor a mayor con radix sort en paralelo.
+ * 
+ * Copia los valores y los nodos a un arreglo auxiliar, lo ordena con radix
+ * sort LSD (estable) repartido entre threads hilos y reenlaza los nodos en un
+ * solo recorrido. Usa O(n) memoria extra a cambio de no comparar elementos;
+ * conviene a partir de ~1M elementos. Los cursores de la lista quedan
+ * invalidados.
+ * 
+ * @param list Lista válida
+ * @param threads Hilos a usar (0 usa los procesadores disponibles)
+ * 
+ * @return
+ * - LIST_OK si la lista se ordenó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_ALLOC si falla malloc (la lista no cambia)
+ */
+ListStatus dlist_sort_radix(DList *list, unsigned threads);
+
 /**
  * @brief Suma todos los elemento de la lista.
  * 
@@ -221,6 +515,226 @@ ListStatus dlist_clear(DList *list);
  */
 ListStatus dlist_sum(DList *list, int *sum);
 
+/**
+ * @brief Suma todos los elementos de la lista repartiendo el recorrido entre varios hilos.
+ * 
+ * La lista se parte en tramos que se suman en paralelo y se combinan; el
+ * resultado es el mismo que el de dlist_sum. En una lista indexada
+ * (dlist_create_indexed) los tramos salen de los carriles exprés; en las
+ * demás hay que recorrer la lista una vez para partirla, así que la
+ * ganancia es menor. Las listas de menos de ~32K elementos se suman en el
+ * hilo que llama. Ningún otro hilo debe modificar la lista mientras tanto.
+ * 
+ * @param list Lista válida
+ * @param threads Hilos a usar (0 usa los procesadores disponibles)
+ * @param sum Puntero donde se almacena la suma
+ * 
+ * @return
+ * - LIST_OK si la suma se hizo correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_par_sum(DList *list, unsigned threads, int *sum);
+
+/**
+ * @brief Busca un elemento en la lista repartiendo el recorrido entre varios hilos.
+ * 
+ * Los tramos se reparten como en dlist_par_sum y los hilos dejan de buscar
+ * en cuanto uno encuentra el elemento.
+ * 
+ * @param list Lista válida
+ * @param threads Hilos a usar (0 usa los procesadores disponibles)
+ * @param value Elemento a buscar
+ * @param found Puntero donde se almacena el resultado
+ * 
+ * @return
+ * - LIST_OK si el elemento se encontró o no
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_par_contains(DList *list, unsigned threads, int value, bool *found);
+
+/**
+ * @brief Aplica fn a cada elemento de la lista repartiendo el recorrido entre varios hilos.
+ * 
+ * Los tramos se reparten como en dlist_par_sum; un hilo que termina los
+ * suyos le quita tramos pendientes a otro, así que elementos con costos
+ * distintos no dejan hilos esperando. fn se llama exactamente una vez por
+ * elemento, desde varios hilos a la vez y en un orden no especificado: si
+ * escribe en ctx debe sincronizarse.
+ * 
+ * @param list Lista válida
+ * @param threads Hilos a usar (0 usa los procesadores disponibles)
+ * @param fn Función que se aplica a cada elemento
+ * @param ctx Contexto que se pasa a fn
+ * 
+ * @return
+ * - LIST_OK si se visitaron todos los elementos
+ * - LIST_ERR_NULL si la lista o fn no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_par_for_each(DList *list, unsigned threads, ListVisit fn, void *ctx);
+
+/**
+ * @brief Calcula varios agregados de la lista en un solo recorrido.
+ * 
+ * Los valores se reúnen en bloques y se reducen con instrucciones SIMD
+ * (AVX2 o SSE2, elegidas en tiempo de ejecución) o con código escalar.
+ * 
+ * @param list Lista válida
+ * @param flags Combinación de ListAggregateFlags con los agregados a calcular
+ * @param value Valor a contar con LIST_AGG_COUNT_EQUAL
+ * @param result Puntero donde se almacenan los agregados pedidos
+ * 
+ * @return
+ * - LIST_OK si los agregados se calcularon correctamente
+ * - LIST_ERR_NULL si la lista o result no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_aggregate(DList *list, unsigned flags, int value, ListAggregate *result);
+
+/**
+ * @brief Suma todos los elementos de la lista en 64 bits, sin desbordarse.
+ * 
+ * @param list Lista válida
+ * @param sum Puntero donde se almacena la suma
+ * 
+ * @return
+ * - LIST_OK si la suma se hizo correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_sum64(DList *list, long long *sum);
+
+/**
+ * @brief Devuelve el elemento mínimo de la lista.
+ * 
+ * @param list Lista válida
+ * @param min Puntero donde se almacena el mínimo
+ * 
+ * @return
+ * - LIST_OK si se obtuvo el mínimo
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_min(DList *list, int *min);
+
+/**
+ * @brief Devuelve el elemento máximo de la lista.
+ * 
+ * @param list Lista válida
+ * @param max Puntero donde se almacena el máximo
+ * 
+ * @return
+ * - LIST_OK si se obtuvo el máximo
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_max(DList *list, int *max);
+
+/**
+ * @brief Devuelve el mínimo y el máximo de la lista en un solo recorrido.
+ * 
+ * @param list Lista válida
+ * @param min Puntero donde se almacena el mínimo
+ * @param max Puntero donde se almacena el máximo
+ * 
+ * @return
+ * - LIST_OK si se obtuvieron ambos valores
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_minmax(DList *list, int *min, int *max);
+
+/**
+ * @brief Cuenta los elementos de la lista iguales a value.
+ * 
+ * @param list Lista válida
+ * @param value Elemento a contar
+ * @param count Puntero donde se almacena el número de apariciones
+ * 
+ * @return
+ * - LIST_OK si se contaron los elementos
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus dlist_count_if_equal(DList *list, int value, int *count);
+
+/**
+ * @brief Copia los elementos de la lista en un arreglo, en orden.
+ * 
+ * Recorre la lista una sola vez haciendo prefetch de los nodos siguientes.
+ * Si cap es menor que el número de elementos se copian solo los primeros cap.
+ * 
+ * @param list Lista válida
+ * @param out Arreglo de destino
+ * @param cap Capacidad de out
+ * @param written Puntero donde se almacena el número de elementos copiados
+ * 
+ * @return
+ * - LIST_OK si se copió toda la lista
+ * - LIST_ERR_NULL si la lista, out o written no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE si out no alcanzó para toda la lista
+ */
+ListStatus dlist_to_array(DList *list, int *out, size_t cap, size_t *written);
+
+/**
+ * @brief Copia los elementos de la lista en un arreglo, de tail a head.
+ * 
+ * Igual que dlist_to_array, pero recorriendo los enlaces prev.
+ * 
+ * @param list Lista válida
+ * @param out Arreglo de destino
+ * @param cap Capacidad de out
+ * @param written Puntero donde se almacena el número de elementos copiados
+ * 
+ * @return
+ * - LIST_OK si se copió toda la lista
+ * - LIST_ERR_NULL si la lista, out o written no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE si out no alcanzó para toda la lista
+ */
+ListStatus dlist_to_array_reverse(DList *list, int *out, size_t cap, size_t *written);
+
+/**
+ * @brief Guarda la lista en fd con un formato binario versionado y con checksum.
+ * 
+ * Escribe desde la posición actual de fd en chunks de 64K valores, cada uno
+ * con su CRC32C, con una sola llamada a write por chunk. El archivo puede
+ * cargarse con slist_load o dlist_load. fd no se cierra ni se sincroniza.
+ * 
+ * @param list Lista válida (puede estar vacía)
+ * @param fd Descriptor abierto para escritura
+ * 
+ * @return
+ * - LIST_OK si la lista se guardó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_ALLOC si falla malloc del búfer
+ * - LIST_ERR_IO si falla write
+ */
+ListStatus dlist_save(DList *list, int fd);
+
+/**
+ * @brief Crea una lista con el contenido guardado por slist_save o dlist_save.
+ * 
+ * Lee desde la posición actual de fd un chunk a la vez. La lista se crea con
+ * pool y los nodos de cada chunk se reservan y enlazan en un solo bloque. Se
+ * valida la versión y el checksum de cada chunk; si algo falla no se crea
+ * ninguna lista.
+ * 
+ * @param fd Descriptor abierto para lectura
+ * @param out Puntero donde se devuelve la lista nueva
+ * 
+ * @return
+ * - LIST_OK si la lista se cargó correctamente
+ * - LIST_ERR_NULL si out es NULL
+ * - LIST_ERR_ALLOC si falla malloc
+ * - LIST_ERR_IO si falla read
+ * - LIST_ERR_FORMAT si los datos están truncados, son de otra versión o no coincide un checksum
+ */
+ListStatus dlist_load(int fd, DList **out);
+
 /**
  * @brief Destruye toda la lista.
  * 
@@ -239,6 +753,113 @@ ListStatus dlist_destroy(DList *list);
  */
 void dlist_show(DList *list);
 
+/**
+ * @brief Coloca el cursor en el primer elemento de la lista.
+ * 
+ * Si la lista está vacía el cursor queda al final.
+ * 
+ * @param list Lista válida
+ * @param cursor Cursor a inicializar
+ * 
+ * @return
+ * - LIST_OK si el cursor se inicializó correctamente
+ * - LIST_ERR_NULL si la lista o el cursor no existen
+ */
+ListStatus dlist_cursor_begin(DList *list, DListCursor *cursor);
+
+/**
+ * @brief Avanza el cursor al siguiente elemento.
+ * 
+ * @param cursor Cursor válido
+ * 
+ * @return
+ * - LIST_OK si el cursor avanzó
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor ya estaba al final
+ */
+ListStatus dlist_cursor_next(DListCursor *cursor);
+
+/**
+ * @brief Retrocede el cursor al elemento anterior.
+ * 
+ * Desde el final de la lista el cursor pasa al último elemento.
+ * 
+ * @param cursor Cursor válido
+ * 
+ * @return
+ * - LIST_OK si el cursor retrocedió
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor ya estaba en el primer elemento
+ */
+ListStatus dlist_cursor_prev(DListCursor *cursor);
+
+/**
+ * @brief Devuelve el elemento bajo el cursor.
+ * 
+ * @param cursor Cursor válido
+ * @param value Puntero donde se almacena el elemento
+ * 
+ * @return
+ * - LIST_OK si se devolvió el elemento
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor está al final
+ */
+ListStatus dlist_cursor_get(DListCursor *cursor, int *value);
+
+/**
+ * @brief Reemplaza el elemento bajo el cursor.
+ * 
+ * @param cursor Cursor válido
+ * @param value Nuevo elemento
+ * 
+ * @return
+ * - LIST_OK si se reemplazó el elemento
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor está al final
+ */
+ListStatus dlist_cursor_set(DListCursor *cursor, int value);
+
+/**
+ * @brief Inserta un elemento antes del cursor, que sigue en el mismo elemento.
+ * 
+ * Con el cursor al final el elemento se inserta al final de la lista.
+ * 
+ * @param cursor Cursor válido
+ * @param value Elemento a insertar
+ * 
+ * @return
+ * - LIST_OK si se insertó el elemento
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus dlist_cursor_insert_before(DListCursor *cursor, int value);
+
+/**
+ * @brief Inserta un elemento después del cursor, que sigue en el mismo elemento.
+ * 
+ * @param cursor Cursor válido
+ * @param value Elemento a insertar
+ * 
+ * @return
+ * - LIST_OK si se insertó el elemento
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor está al final
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus dlist_cursor_insert_after(DListCursor *cursor, int value);
+
+/**
+ * @brief Elimina el elemento bajo el cursor y lo mueve al siguiente.
+ * 
+ * @param cursor Cursor válido
+ * 
+ * @return
+ * - LIST_OK si se eliminó el elemento
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor está al final
+ */
+ListStatus dlist_cursor_erase(DListCursor *cursor);
+
 #ifdef __cplusplus
 }
 #endif
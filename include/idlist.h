@@ -0,0 +1,300 @@
+#ifndef IDLIST_H
+#define IDLIST_H
+
+#include "list_status.h"
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Lista doblemente enlazada compacta: los nodos se guardan en arreglos por
+ * segmentos y se enlazan por índices de 32 bits, de modo que cada nodo ocupa
+ * 12 bytes (DList usa 24 más la cabecera de malloc). Misma convención que
+ * dlist.h para posiciones y códigos de error.
+ */
+typedef struct IDList IDList;
+
+/**
+ * @brief Crea una lista doblemente enlazada compacta.
+ *
+ * @return
+ * - Puntero a la lista si se creó correctamente
+ * - NULL si falla malloc
+ */
+IDList *idlist_create(void);
+
+/**
+ * @brief Obtiene el número de elementos en la lista.
+ *
+ * @param list Lista válida
+ * @param count Puntero donde se almacena el número de elementos
+ *
+ * @return
+ * - LIST_OK si se obtuvo el número de elementos correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus idlist_size(IDList *list, int *count);
+
+/**
+ * @brief Obtiene el tamaño de la lista en bytes (manejador y nodos reservados).
+ *
+ * @param list Lista válida
+ * @param bytes Puntero donde se almacena el número de bytes
+ *
+ * @return
+ * - LIST_OK si se obtuvo el tamaño en bytes
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus idlist_size_bytes(IDList *list, size_t *bytes);
+
+/**
+ * @brief Determina si la lista está vacía.
+ *
+ * @param list Lista válida
+ * @param is_empty Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si se determinó el resultado
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus idlist_is_empty(IDList *list, bool *is_empty);
+
+/**
+ * @brief Busca un elemento en la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a buscar
+ * @param found Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró o no
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus idlist_contains(IDList *list, int value, bool *found);
+
+/**
+ * @brief Inserta un elemento al final de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_ALLOC si malloc falla
+ * - LIST_ERR_OUT_OF_RANGE si la lista ya tiene INT_MAX elementos
+ */
+ListStatus idlist_push_back(IDList *list, int value);
+
+/**
+ * @brief Inserta un elemento al inicio de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_ALLOC si malloc falla
+ * - LIST_ERR_OUT_OF_RANGE si la lista ya tiene INT_MAX elementos
+ */
+ListStatus idlist_push_front(IDList *list, int value);
+
+/**
+ * @brief Inserta un elemento en cualquier posición válida de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ * @param pos Posición en la que se inserta
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus idlist_insert_in_position(IDList *list, int value, int pos);
+
+/**
+ * @brief Reemplaza un elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento por reemplazar
+ * @param pos Posición del elemento a reemplazar
+ *
+ * @return
+ * - LIST_OK si se reemplazó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus idlist_change_value(IDList *list, int value, int pos);
+
+/**
+ * @brief Devuelve la posición del elemento a buscar en la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a buscar en la lista
+ * @param pos Puntero donde se almacena la posición
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_NOT_FOUND si no se encontró el elemento
+ */
+ListStatus idlist_search_for_value(IDList *list, int value, int *pos);
+
+/**
+ * @brief Devuelve el elemento en la posición solicitada
+ *
+ * @param list Lista válida
+ * @param pos Posición solicitada
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus idlist_search_for_position(IDList *list, int pos, int *value);
+
+/**
+ * @brief Devuelve el primer elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si se devolvió el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus idlist_front(IDList *list, int *value);
+
+/**
+ * @brief Devuelve el último elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si se devolvió el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus idlist_back(IDList *list, int *value);
+
+/**
+ * @brief Elimina un elemento de la lista en cualquier posición.
+ *
+ * @param list Lista válida
+ * @param pos Posición del elemento a liberar
+ *
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus idlist_free_in_position(IDList *list, int pos);
+
+/**
+ * @brief Elimina el primer elemento de la lista y lo devuelve en value.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ *
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista o value no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus idlist_pop_front(IDList *list, int *value);
+
+/**
+ * @brief Elimina el último elemento de la lista y lo devuelve en value.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ *
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista o value no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus idlist_pop_back(IDList *list, int *value);
+
+/**
+ * @brief Vacía toda la lista.
+ *
+ * Libera todos los segmentos de nodos de una vez, sin recorrer la lista.
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si la lista se vació correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus idlist_clear(IDList *list);
+
+/**
+ * @brief Suma todos los elementos de la lista.
+ *
+ * @param list Lista válida
+ * @param sum Puntero donde se almacena la suma
+ *
+ * @return
+ * - LIST_OK si la suma se hizo correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus idlist_sum(IDList *list, int *sum);
+
+/**
+ * @brief Copia los elementos de la lista en un arreglo, en orden.
+ *
+ * Si cap es menor que el número de elementos se copian solo los primeros cap.
+ *
+ * @param list Lista válida
+ * @param out Arreglo de destino
+ * @param cap Capacidad de out
+ * @param written Puntero donde se almacena el número de elementos copiados
+ *
+ * @return
+ * - LIST_OK si se copió toda la lista
+ * - LIST_ERR_NULL si la lista, out o written no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE si out no alcanzó para toda la lista
+ */
+ListStatus idlist_to_array(IDList *list, int *out, size_t cap, size_t *written);
+
+/**
+ * @brief Destruye toda la lista.
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si la lista se destruyó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus idlist_destroy(IDList *list);
+
+/**
+ * @brief Imprime la lista.
+ *
+ * @param list Lista válida
+ */
+void idlist_show(IDList *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IDLIST_H */
@@ -0,0 +1,36 @@
+#ifndef LIST_AGGREGATE_H
+#define LIST_AGGREGATE_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @enum ListAggregateFlags
+ * @brief Agregados que se pueden pedir juntos en un solo recorrido.
+ */
+typedef enum {
+    LIST_AGG_SUM = 1 << 0, /**< Suma en 64 bits */
+    LIST_AGG_MIN = 1 << 1, /**< Elemento mínimo */
+    LIST_AGG_MAX = 1 << 2, /**< Elemento máximo */
+    LIST_AGG_COUNT_EQUAL = 1 << 3 /**< Elementos iguales a un valor */
+} ListAggregateFlags;
+
+/**
+ * @struct ListAggregate
+ * @brief Resultado de *_aggregate. Solo son válidos los campos pedidos.
+ */
+typedef struct ListAggregate {
+    long long sum; /**< Suma de los elementos (LIST_AGG_SUM) */
+    int min; /**< Elemento mínimo (LIST_AGG_MIN) */
+    int max; /**< Elemento máximo (LIST_AGG_MAX) */
+    int equal_count; /**< Elementos iguales al valor dado (LIST_AGG_COUNT_EQUAL) */
+} ListAggregate;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIST_AGGREGATE_H */
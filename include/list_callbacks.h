@@ -0,0 +1,40 @@
+#ifndef LIST_CALLBACKS_H
+#define LIST_CALLBACKS_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Función de comparación para ordenar listas.
+ * 
+ * @return Negativo si a va antes que b, 0 si son equivalentes y positivo si
+ * a va después de b (como en qsort).
+ */
+typedef int (*ListCompare)(int a, int b);
+
+/**
+ * @brief Condición sobre un elemento, para *_remove_if.
+ * 
+ * @param value Elemento evaluado
+ * @param ctx Contexto del usuario, el mismo que se pasó a la función
+ * 
+ * @return true si el elemento cumple la condición
+ */
+typedef bool (*ListPredicate)(int value, void *ctx);
+
+/**
+ * @brief Función que se aplica a cada elemento, para *_par_for_each.
+ * 
+ * @param value Elemento visitado
+ * @param ctx Contexto del usuario, el mismo que se pasó a la función
+ */
+typedef void (*ListVisit)(int value, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIST_CALLBACKS_H */
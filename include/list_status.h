@@ -1,4 +1,4 @@
-#ifndef LIST_STATUS_h
+#ifndef LIST_STATUS_H
 #define LIST_STATUS_H
 
 #ifdef __cplusplus
@@ -18,7 +18,10 @@ typedef enum {
     LIST_ERR_EMPTY = -2, /**< Lista vacía */
     LIST_ERR_ALLOC = -3, /**< Error al reservar memoria */
     LIST_ERR_OUT_OF_RANGE = -4, /**< Posición fuera de rango */
-    LIST_ERR_NOT_FOUND = -5 /**< Elemento no encontrado */
+    LIST_ERR_NOT_FOUND = -5, /**< Elemento no encontrado */
+    LIST_ERR_IO = -6, /**< Error de lectura o escritura */
+    LIST_ERR_FORMAT = -7, /**< Datos con formato, versión o checksum inválidos */
+    LIST_ERR_ORDER = -8 /**< Elemento menor que el último de una lista ordenada */
 } ListStatus;
 
 #ifdef __cplusplus
@@ -0,0 +1,342 @@
+#ifndef MLIST_H
+#define MLIST_H
+
+#include "list_status.h"
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Lista doblemente enlazada que vive en un archivo. Los nodos están en una
+ * región mapeada con mmap y se enlazan por índices de 32 bits dentro del
+ * archivo en lugar de punteros, así que abrir una lista existente cuesta O(1)
+ * sin importar su tamaño: el sistema operativo carga las páginas conforme se
+ * recorren. Los cambios llegan al archivo a través del page cache; mlist_flush
+ * los fuerza a disco.
+ */
+typedef struct MList MList;
+
+/**
+ * @brief Crea un archivo de lista vacío (lo trunca si ya existe) y lo abre.
+ *
+ * @param path Ruta del archivo
+ * @param out Puntero donde se devuelve la lista
+ *
+ * @return
+ * - LIST_OK si la lista se creó correctamente
+ * - LIST_ERR_NULL si path u out son NULL
+ * - LIST_ERR_ALLOC si falla malloc
+ * - LIST_ERR_IO si no se pudo crear, agrandar o mapear el archivo
+ */
+ListStatus mlist_create(const char *path, MList **out);
+
+/**
+ * @brief Abre un archivo de lista creado con mlist_create.
+ *
+ * Solo se valida la cabecera: no se recorre ningún nodo.
+ *
+ * @param path Ruta del archivo
+ * @param out Puntero donde se devuelve la lista
+ *
+ * @return
+ * - LIST_OK si la lista se abrió correctamente
+ * - LIST_ERR_NULL si path u out son NULL
+ * - LIST_ERR_ALLOC si falla malloc
+ * - LIST_ERR_IO si no se pudo abrir o mapear el archivo
+ * - LIST_ERR_FORMAT si el archivo no es una lista, es de otra versión o está truncado
+ */
+ListStatus mlist_open(const char *path, MList **out);
+
+/**
+ * @brief Escribe en disco los cambios pendientes (msync síncrono).
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si los cambios llegaron a disco
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ * - LIST_ERR_IO si falla msync
+ */
+ListStatus mlist_flush(MList *list);
+
+/**
+ * @brief Obtiene el número de elementos en la lista.
+ *
+ * @param list Lista válida
+ * @param count Puntero donde se almacena el número de elementos
+ *
+ * @return
+ * - LIST_OK si se obtuvo el número de elementos correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ */
+ListStatus mlist_size(MList *list, int *count);
+
+/**
+ * @brief Obtiene el tamaño de la lista en bytes (región mapeada y manejador).
+ *
+ * @param list Lista válida
+ * @param bytes Puntero donde se almacena el número de bytes
+ *
+ * @return
+ * - LIST_OK si se obtuvo el tamaño en bytes
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ */
+ListStatus mlist_size_bytes(MList *list, size_t *bytes);
+
+/**
+ * @brief Determina si la lista está vacía.
+ *
+ * @param list Lista válida
+ * @param is_empty Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si se determinó el resultado
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ */
+ListStatus mlist_is_empty(MList *list, bool *is_empty);
+
+/**
+ * @brief Busca un elemento en la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a buscar
+ * @param found Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró o no
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus mlist_contains(MList *list, int value, bool *found);
+
+/**
+ * @brief Inserta un elemento al final de la lista.
+ *
+ * Si no quedan nodos libres el archivo crece al doble.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ * - LIST_ERR_IO si no se pudo agrandar o volver a mapear el archivo
+ * - LIST_ERR_OUT_OF_RANGE si la lista ya tiene INT_MAX elementos
+ */
+ListStatus mlist_push_back(MList *list, int value);
+
+/**
+ * @brief Inserta un elemento al inicio de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ * - LIST_ERR_IO si no se pudo agrandar o volver a mapear el archivo
+ * - LIST_ERR_OUT_OF_RANGE si la lista ya tiene INT_MAX elementos
+ */
+ListStatus mlist_push_front(MList *list, int value);
+
+/**
+ * @brief Inserta un elemento en cualquier posición válida de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ * @param pos Posición en la que se inserta
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ * - LIST_ERR_IO si no se pudo agrandar o volver a mapear el archivo
+ */
+ListStatus mlist_insert_in_position(MList *list, int value, int pos);
+
+/**
+ * @brief Reemplaza un elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento por reemplazar
+ * @param pos Posición del elemento a reemplazar
+ *
+ * @return
+ * - LIST_OK si se reemplazó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus mlist_change_value(MList *list, int value, int pos);
+
+/**
+ * @brief Devuelve la posición del elemento a buscar en la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a buscar en la lista
+ * @param pos Puntero donde se almacena la posición
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_NOT_FOUND si no se encontró el elemento
+ */
+ListStatus mlist_search_for_value(MList *list, int value, int *pos);
+
+/**
+ * @brief Devuelve el elemento en la posición solicitada
+ *
+ * @param list Lista válida
+ * @param pos Posición solicitada
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus mlist_search_for_position(MList *list, int pos, int *value);
+
+/**
+ * @brief Devuelve el primer elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si se devolvió el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus mlist_front(MList *list, int *value);
+
+/**
+ * @brief Devuelve el último elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si se devolvió el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus mlist_back(MList *list, int *value);
+
+/**
+ * @brief Elimina un elemento de la lista en cualquier posición.
+ *
+ * El nodo queda en la lista de libres del archivo para reutilizarse.
+ *
+ * @param list Lista válida
+ * @param pos Posición del elemento a liberar
+ *
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus mlist_free_in_position(MList *list, int pos);
+
+/**
+ * @brief Elimina el primer elemento de la lista y lo devuelve en value.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ *
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista o value no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus mlist_pop_front(MList *list, int *value);
+
+/**
+ * @brief Elimina el último elemento de la lista y lo devuelve en value.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ *
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista o value no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus mlist_pop_back(MList *list, int *value);
+
+/**
+ * @brief Vacía toda la lista.
+ *
+ * El archivo conserva su tamaño; los nodos se reutilizan en las próximas inserciones.
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si la lista se vació correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus mlist_clear(MList *list);
+
+/**
+ * @brief Suma todos los elementos de la lista.
+ *
+ * @param list Lista válida
+ * @param sum Puntero donde se almacena la suma
+ *
+ * @return
+ * - LIST_OK si la suma se hizo correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus mlist_sum(MList *list, int *sum);
+
+/**
+ * @brief Copia los elementos de la lista en un arreglo, en orden.
+ *
+ * Si cap es menor que el número de elementos se copian solo los primeros cap.
+ *
+ * @param list Lista válida
+ * @param out Arreglo de destino
+ * @param cap Capacidad de out
+ * @param written Puntero donde se almacena el número de elementos copiados
+ *
+ * @return
+ * - LIST_OK si se copió toda la lista
+ * - LIST_ERR_NULL si la lista, out o written no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE si out no alcanzó para toda la lista
+ */
+ListStatus mlist_to_array(MList *list, int *out, size_t cap, size_t *written);
+
+/**
+ * @brief Cierra la lista: desmapea el archivo y libera el manejador.
+ *
+ * No espera a que los cambios lleguen a disco; para eso está mlist_flush.
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si la lista se cerró correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue abierta
+ */
+ListStatus mlist_close(MList *list);
+
+/**
+ * @brief Imprime la lista.
+ *
+ * @param list Lista válida
+ */
+void mlist_show(MList *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MLIST_H */
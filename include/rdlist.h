@@ -0,0 +1,256 @@
+#ifndef RDLIST_H
+#define RDLIST_H
+
+#include "list_status.h"
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Lista doblemente enlazada para cargas de muchas lecturas y pocas
+ * escrituras, al estilo RCU (read-copy-update). Los lectores (contains,
+ * sum, search_for_position, to_array...) no toman ningún candado: recorren
+ * los enlaces next con lecturas acquire y solo escriben en un registro
+ * propio del hilo, así que no comparten ninguna línea de caché entre sí.
+ * Los escritores se serializan con un mutex y publican cada cambio con una
+ * sola escritura release; los nodos que quitan se liberan cuando termina
+ * el periodo de gracia, es decir, cuando ya salieron todos los lectores
+ * que podían estar viéndolos.
+ *
+ * Un lector ve la lista antes o después de cada cambio, nunca a medias,
+ * pero un recorrido largo puede mezclar cambios que ocurrieron mientras
+ * avanzaba. Las posiciones siguen la convención de dlist.h. Hasta
+ * EPOCH_MAX_THREADS (256) hilos vivos pueden usar estructuras concurrentes a
+ * la vez; las lecturas de un hilo más devuelven LIST_ERR_ALLOC.
+ */
+typedef struct RDList RDList;
+
+/**
+ * @brief Crea una lista RCU vacía.
+ *
+ * @return
+ * - Puntero a la lista si se creó correctamente
+ * - NULL si falla malloc
+ */
+RDList *rdlist_create(void);
+
+/**
+ * @brief Obtiene el número de elementos en la lista.
+ *
+ * @param list Lista válida
+ * @param count Puntero donde se almacena el número de elementos
+ *
+ * @return
+ * - LIST_OK si se obtuvo el número de elementos correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus rdlist_size(RDList *list, int *count);
+
+/**
+ * @brief Determina si la lista está vacía en el momento de la llamada.
+ *
+ * @param list Lista válida
+ * @param is_empty Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si se determinó el resultado
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus rdlist_is_empty(RDList *list, bool *is_empty);
+
+/**
+ * @brief Busca un elemento en la lista sin bloquear a otros hilos.
+ *
+ * @param list Lista válida
+ * @param value Elemento a buscar
+ * @param found Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró o no
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_ALLOC si ya hay EPOCH_MAX_THREADS hilos registrados
+ */
+ListStatus rdlist_contains(RDList *list, int value, bool *found);
+
+/**
+ * @brief Suma todos los elementos de la lista sin bloquear a otros hilos.
+ *
+ * @param list Lista válida
+ * @param sum Puntero donde se almacena la suma
+ *
+ * @return
+ * - LIST_OK si la suma se hizo correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_ALLOC si ya hay EPOCH_MAX_THREADS hilos registrados
+ */
+ListStatus rdlist_sum(RDList *list, int *sum);
+
+/**
+ * @brief Devuelve el elemento en la posición solicitada sin bloquear a otros hilos.
+ *
+ * @param list Lista válida
+ * @param pos Posición solicitada
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ * - LIST_ERR_ALLOC si ya hay EPOCH_MAX_THREADS hilos registrados
+ */
+ListStatus rdlist_search_for_position(RDList *list, int pos, int *value);
+
+/**
+ * @brief Copia los elementos de la lista en un arreglo, en orden.
+ *
+ * La copia se hace en un solo recorrido sin bloquear a otros hilos. Si cap
+ * es menor que el número de elementos se copian solo los primeros cap.
+ *
+ * @param list Lista válida
+ * @param out Arreglo de destino
+ * @param cap Capacidad de out
+ * @param written Puntero donde se almacena el número de elementos copiados
+ *
+ * @return
+ * - LIST_OK si se copió toda la lista
+ * - LIST_ERR_NULL si la lista, out o written no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE si out no alcanzó para toda la lista
+ * - LIST_ERR_ALLOC si ya hay EPOCH_MAX_THREADS hilos registrados
+ */
+ListStatus rdlist_to_array(RDList *list, int *out, size_t cap, size_t *written);
+
+/**
+ * @brief Inserta un elemento al final de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus rdlist_push_back(RDList *list, int value);
+
+/**
+ * @brief Inserta un elemento al inicio de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus rdlist_push_front(RDList *list, int value);
+
+/**
+ * @brief Inserta un elemento en cualquier posición válida de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ * @param pos Posición en la que se inserta
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus rdlist_insert_in_position(RDList *list, int value, int pos);
+
+/**
+ * @brief Reemplaza un elemento de la lista.
+ *
+ * El nodo se sustituye por una copia con el nuevo valor, así que un lector
+ * ve el valor anterior o el nuevo, nunca otro.
+ *
+ * @param list Lista válida
+ * @param value Elemento por reemplazar
+ * @param pos Posición del elemento a reemplazar
+ *
+ * @return
+ * - LIST_OK si se reemplazó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus rdlist_change_value(RDList *list, int value, int pos);
+
+/**
+ * @brief Elimina un elemento de la lista en cualquier posición.
+ *
+ * @param list Lista válida
+ * @param pos Posición del elemento a liberar
+ *
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus rdlist_free_in_position(RDList *list, int pos);
+
+/**
+ * @brief Elimina el primer elemento de la lista y lo devuelve.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ *
+ * @return
+ * - LIST_OK si se eliminó el elemento correctamente
+ * - LIST_ERR_NULL si la lista o value no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus rdlist_pop_front(RDList *list, int *value);
+
+/**
+ * @brief Elimina el último elemento de la lista y lo devuelve.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ *
+ * @return
+ * - LIST_OK si se eliminó el elemento correctamente
+ * - LIST_ERR_NULL si la lista o value no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus rdlist_pop_back(RDList *list, int *value);
+
+/**
+ * @brief Espera a que termine el periodo de gracia y libera los nodos que el
+ *        hilo que llama quitó de cualquier lista RCU.
+ *
+ * No es necesario llamarla: los nodos pendientes se liberan solos cada
+ * cierto número de cambios. Sirve para que un escritor que hace pocos
+ * cambios devuelva la memoria en ese momento.
+ */
+void rdlist_synchronize(void);
+
+/**
+ * @brief Destruye toda la lista.
+ *
+ * Ningún otro hilo debe estar usando la lista.
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si la lista se destruyó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus rdlist_destroy(RDList *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RDLIST_H */
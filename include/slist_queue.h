@@ -0,0 +1,129 @@
+#ifndef SLIST_QUEUE_H
+#define SLIST_QUEUE_H
+
+#include "list_status.h"
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Cola FIFO concurrente sin bloqueos (cola de Michael y Scott). Es una
+ * lista simplemente enlazada con head y tail, como SList, pero head apunta
+ * siempre a un nodo vacío: se encola enlazando después de tail y se
+ * desencola moviendo head al siguiente nodo, así que productores y
+ * consumidores no compiten por el mismo puntero. Varios hilos pueden encolar
+ * y desencolar a la vez.
+ *
+ * Los nodos desencolados se liberan por épocas: solo cuando ningún hilo que
+ * estaba dentro de una operación puede seguir leyéndolos. Hasta
+ * EPOCH_MAX_THREADS (256) hilos vivos pueden usar estructuras concurrentes a
+ * la vez; las operaciones de un hilo más devuelven LIST_ERR_ALLOC.
+ */
+typedef struct SListQueue SListQueue;
+
+/**
+ * @brief Crea una cola concurrente vacía.
+ *
+ * @return
+ * - Puntero a la cola si se creó correctamente
+ * - NULL si falla malloc
+ */
+SListQueue *slist_queue_create(void);
+
+/**
+ * @brief Obtiene el número de elementos en la cola.
+ *
+ * El contador se actualiza después de cada operación sin sincronizarse con
+ * ella: con otros hilos modificando la cola el resultado es aproximado.
+ *
+ * @param queue Cola válida
+ * @param count Puntero donde se almacena el número de elementos
+ *
+ * @return
+ * - LIST_OK si se obtuvo el número de elementos correctamente
+ * - LIST_ERR_NULL si la cola no existe o no fue creada
+ */
+ListStatus slist_queue_size(SListQueue *queue, int *count);
+
+/**
+ * @brief Determina si la cola está vacía en el momento de la llamada.
+ *
+ * @param queue Cola válida
+ * @param is_empty Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si se determinó el resultado
+ * - LIST_ERR_NULL si la cola no existe o no fue creada
+ * - LIST_ERR_ALLOC si ya hay EPOCH_MAX_THREADS hilos registrados
+ */
+ListStatus slist_queue_is_empty(SListQueue *queue, bool *is_empty);
+
+/**
+ * @brief Inserta un elemento al final de la cola. Se puede llamar desde varios hilos a la vez.
+ *
+ * @param queue Cola válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la cola no existe o no fue creada
+ * - LIST_ERR_ALLOC si malloc falla o ya hay EPOCH_MAX_THREADS hilos registrados
+ */
+ListStatus slist_queue_enqueue(SListQueue *queue, int value);
+
+/**
+ * @brief Inserta n elementos al final de la cola con un solo CAS.
+ *
+ * Los nodos se enlazan entre sí antes de unirse a la cola, así que los n
+ * elementos quedan seguidos y en el mismo orden aunque otros hilos encolen
+ * a la vez. Si falla una reserva la cola no cambia.
+ *
+ * @param queue Cola válida
+ * @param values Arreglo con los elementos a insertar
+ * @param n Número de elementos en values
+ *
+ * @return
+ * - LIST_OK si se insertaron los elementos correctamente
+ * - LIST_ERR_NULL si la cola no existe o values es NULL con n > 0
+ * - LIST_ERR_OUT_OF_RANGE si n es mayor que INT_MAX
+ * - LIST_ERR_ALLOC si malloc falla o ya hay EPOCH_MAX_THREADS hilos registrados (no se inserta ningún elemento)
+ */
+ListStatus slist_queue_enqueue_many(SListQueue *queue, const int *values, size_t n);
+
+/**
+ * @brief Elimina el primer elemento de la cola y lo devuelve. Se puede llamar desde varios hilos a la vez.
+ *
+ * @param queue Cola válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ *
+ * @return
+ * - LIST_OK si se eliminó el elemento correctamente
+ * - LIST_ERR_NULL si la cola o value no existen
+ * - LIST_ERR_EMPTY si la cola está vacía
+ * - LIST_ERR_ALLOC si ya hay EPOCH_MAX_THREADS hilos registrados
+ */
+ListStatus slist_queue_dequeue(SListQueue *queue, int *value);
+
+/**
+ * @brief Destruye toda la cola.
+ *
+ * Ningún otro hilo debe estar usando la cola. Los nodos ya desencolados se
+ * liberan por épocas aunque la cola ya no exista.
+ *
+ * @param queue Cola válida
+ *
+ * @return
+ * - LIST_OK si la cola se destruyó correctamente
+ * - LIST_ERR_NULL si la cola no existe o no fue creada
+ */
+ListStatus slist_queue_destroy(SListQueue *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SLIST_QUEUE_H */
@@ -0,0 +1,256 @@
+#ifndef ULIST_H
+#define ULIST_H
+
+#include "list_status.h"
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Lista desenrollada: cada nodo ocupa una línea de caché (64 bytes) y guarda
+ * varios enteros, de modo que los recorridos visitan un nodo por cada bloque
+ * de elementos en lugar de uno por elemento.
+ */
+typedef struct UList UList;
+
+/**
+ * @brief Crea una lista desenrollada.
+ *
+ * @return
+ * - Puntero a la lista si se creó correctamente
+ * - NULL si falla malloc
+ */
+UList *ulist_create(void);
+
+/**
+ * @brief Obtiene el número de elementos en la lista.
+ *
+ * @param list Lista válida
+ * @param count Puntero donde se almacena el número de elementos
+ *
+ * @return
+ * - LIST_OK si se obtuvo el número de elementos correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus ulist_size(UList *list, int *count);
+
+/**
+ * @brief Obtiene el tamaño total de la lista en bytes.
+ *
+ * @param list Lista válida
+ * @param bytes Puntero donde se almacena el número de bytes
+ *
+ * @return
+ * - LIST_OK si se obtuvo el tamaño en bytes
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus ulist_size_bytes(UList *list, size_t *bytes);
+
+/**
+ * @brief Determina si la lista está vacía.
+ *
+ * @param list Lista válida
+ * @param is_empty Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si se determinó el resultado
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus ulist_is_empty(UList *list, bool *is_empty);
+
+/**
+ * @brief Busca un elemento en la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a buscar
+ * @param found Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró o no
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus ulist_contains(UList *list, int value, bool *found);
+
+/**
+ * @brief Inserta un elemento al final de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus ulist_push_back(UList *list, int value);
+
+/**
+ * @brief Inserta un elemento al inicio de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus ulist_push_front(UList *list, int value);
+
+/**
+ * @brief Inserta un elemento en cualquier posición válida de la lista.
+ *
+ * Si el nodo de destino está lleno se divide en dos.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ * @param pos Posición en la que se inserta
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus ulist_insert_in_position(UList *list, int value, int pos);
+
+/**
+ * @brief Reemplaza un elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento por reemplazar
+ * @param pos Posición del elemento a reemplazar
+ *
+ * @return
+ * - LIST_OK si se reemplazó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus ulist_change_value(UList *list, int value, int pos);
+
+/**
+ * @brief Devuelve la posición del elemento a buscar en la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a buscar en la lista
+ * @param pos Puntero donde se almacena la posición
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_NOT_FOUND si no se encontró el elemento
+ */
+ListStatus ulist_search_for_value(UList *list, int value, int *pos);
+
+/**
+ * @brief Devuelve el elemento en la posición solicitada
+ *
+ * @param list Lista válida
+ * @param pos Posición solicitada
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus ulist_search_for_position(UList *list, int pos, int *value);
+
+/**
+ * @brief Devuelve el primer elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si se devolvió el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus ulist_front(UList *list, int *value);
+
+/**
+ * @brief Devuelve el último elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si se devolvió el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus ulist_back(UList *list, int *value);
+
+/**
+ * @brief Elimina un elemento de la lista en cualquier posición.
+ *
+ * Si el nodo queda a menos de la mitad se fusiona con el siguiente
+ * cuando ambos caben en un solo nodo.
+ *
+ * @param list Lista válida
+ * @param pos Posición del elemento a liberar
+ *
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus ulist_free_in_position(UList *list, int pos);
+
+/**
+ * @brief Vacía toda la lista.
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si la lista se vació correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus ulist_clear(UList *list);
+
+/**
+ * @brief Suma todos los elementos de la lista.
+ *
+ * @param list Lista válida
+ * @param sum Puntero donde se almacena la suma
+ *
+ * @return
+ * - LIST_OK si la suma se hizo correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus ulist_sum(UList *list, int *sum);
+
+/**
+ * @brief Destruye toda la lista.
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si la lista se destruyó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus ulist_destroy(UList *list);
+
+/**
+ * @brief Imprime la lista.
+ *
+ * @param list Lista válida
+ */
+void ulist_show(UList *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ULIST_H */
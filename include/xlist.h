@@ -0,0 +1,441 @@
+#ifndef XLIST_H
+#define XLIST_H
+
+#include "list_status.h"
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Lista doblemente enlazada XOR: cada nodo guarda un solo enlace, la
+ * dirección del anterior XOR la del siguiente, y ocupa 16 bytes en lugar de
+ * los 24 de DList. Se recorre en ambos sentidos partiendo de head o de tail.
+ * Los nodos se reservan por slabs, como en dlist_create_pooled. Misma
+ * convención que dlist.h para posiciones y códigos de error.
+ */
+typedef struct XList XList;
+
+/**
+ * @brief Cursor para recorrer y modificar una lista en O(1) por paso.
+ *
+ * Guarda el nodo actual y su vecino hacia head, que hace falta para moverse
+ * en una lista XOR. Sus campos son internos y no deben modificarse
+ * directamente. Cualquier cambio en la lista que no se haga a través del
+ * cursor lo invalida.
+ */
+typedef struct XListCursor {
+    XList *list; /**< Lista recorrida */
+    void *prev; /**< Nodo anterior al actual, NULL en el primero (uso interno) */
+    void *node; /**< Nodo actual, NULL al final de la lista (uso interno) */
+    int pos; /**< Posición del nodo actual (uso interno) */
+} XListCursor;
+
+/**
+ * @brief Crea una lista doblemente enlazada XOR.
+ *
+ * @return
+ * - Puntero a la lista si se creó correctamente
+ * - NULL si falla malloc
+ */
+XList *xlist_create(void);
+
+/**
+ * @brief Obtiene el número de elementos en la lista.
+ *
+ * @param list Lista válida
+ * @param count Puntero donde se almacena el número de elementos
+ *
+ * @return
+ * - LIST_OK si se obtuvo el número de elementos correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus xlist_size(XList *list, int *count);
+
+/**
+ * @brief Obtiene el tamaño de la lista en bytes (manejador y slabs de nodos).
+ *
+ * @param list Lista válida
+ * @param bytes Puntero donde se almacena el número de bytes
+ *
+ * @return
+ * - LIST_OK si se obtuvo el tamaño en bytes
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus xlist_size_bytes(XList *list, size_t *bytes);
+
+/**
+ * @brief Determina si la lista está vacía.
+ *
+ * @param list Lista válida
+ * @param is_empty Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si se determinó el resultado
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus xlist_is_empty(XList *list, bool *is_empty);
+
+/**
+ * @brief Busca un elemento en la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a buscar
+ * @param found Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró o no
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus xlist_contains(XList *list, int value, bool *found);
+
+/**
+ * @brief Inserta un elemento al final de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_ALLOC si malloc falla
+ * - LIST_ERR_OUT_OF_RANGE si la lista ya tiene INT_MAX elementos
+ */
+ListStatus xlist_push_back(XList *list, int value);
+
+/**
+ * @brief Inserta un elemento al inicio de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_ALLOC si malloc falla
+ * - LIST_ERR_OUT_OF_RANGE si la lista ya tiene INT_MAX elementos
+ */
+ListStatus xlist_push_front(XList *list, int value);
+
+/**
+ * @brief Inserta un elemento en cualquier posición válida de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar
+ * @param pos Posición en la que se inserta
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus xlist_insert_in_position(XList *list, int value, int pos);
+
+/**
+ * @brief Reemplaza un elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento por reemplazar
+ * @param pos Posición del elemento a reemplazar
+ *
+ * @return
+ * - LIST_OK si se reemplazó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus xlist_change_value(XList *list, int value, int pos);
+
+/**
+ * @brief Devuelve la posición del elemento a buscar en la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a buscar en la lista
+ * @param pos Puntero donde se almacena la posición
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_NOT_FOUND si no se encontró el elemento
+ */
+ListStatus xlist_search_for_value(XList *list, int value, int *pos);
+
+/**
+ * @brief Devuelve el elemento en la posición solicitada
+ *
+ * @param list Lista válida
+ * @param pos Posición solicitada
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus xlist_search_for_position(XList *list, int pos, int *value);
+
+/**
+ * @brief Devuelve el primer elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si se devolvió el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus xlist_front(XList *list, int *value);
+
+/**
+ * @brief Devuelve el último elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si se devolvió el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus xlist_back(XList *list, int *value);
+
+/**
+ * @brief Elimina un elemento de la lista en cualquier posición.
+ *
+ * @param list Lista válida
+ * @param pos Posición del elemento a liberar
+ *
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus xlist_free_in_position(XList *list, int pos);
+
+/**
+ * @brief Elimina el primer elemento de la lista y lo devuelve en value.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ *
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista o value no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus xlist_pop_front(XList *list, int *value);
+
+/**
+ * @brief Elimina el último elemento de la lista y lo devuelve en value.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento eliminado
+ *
+ * @return
+ * - LIST_OK si el elemento se eliminó correctamente
+ * - LIST_ERR_NULL si la lista o value no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus xlist_pop_back(XList *list, int *value);
+
+/**
+ * @brief Vacía toda la lista.
+ *
+ * Libera todos los slabs de nodos de una vez, sin recorrer la lista.
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si la lista se vació correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus xlist_clear(XList *list);
+
+/**
+ * @brief Suma todos los elementos de la lista.
+ *
+ * @param list Lista válida
+ * @param sum Puntero donde se almacena la suma
+ *
+ * @return
+ * - LIST_OK si la suma se hizo correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus xlist_sum(XList *list, int *sum);
+
+/**
+ * @brief Copia los elementos de la lista en un arreglo, en orden.
+ *
+ * Si cap es menor que el número de elementos se copian solo los primeros cap.
+ *
+ * @param list Lista válida
+ * @param out Arreglo de destino
+ * @param cap Capacidad de out
+ * @param written Puntero donde se almacena el número de elementos copiados
+ *
+ * @return
+ * - LIST_OK si se copió toda la lista
+ * - LIST_ERR_NULL si la lista, out o written no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE si out no alcanzó para toda la lista
+ */
+ListStatus xlist_to_array(XList *list, int *out, size_t cap, size_t *written);
+
+/**
+ * @brief Copia los elementos de la lista en un arreglo, de tail a head.
+ *
+ * Igual que xlist_to_array, pero partiendo de tail.
+ *
+ * @param list Lista válida
+ * @param out Arreglo de destino
+ * @param cap Capacidad de out
+ * @param written Puntero donde se almacena el número de elementos copiados
+ *
+ * @return
+ * - LIST_OK si se copió toda la lista
+ * - LIST_ERR_NULL si la lista, out o written no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE si out no alcanzó para toda la lista
+ */
+ListStatus xlist_to_array_reverse(XList *list, int *out, size_t cap, size_t *written);
+
+/**
+ * @brief Destruye toda la lista.
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si la lista se destruyó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus xlist_destroy(XList *list);
+
+/**
+ * @brief Imprime la lista.
+ *
+ * @param list Lista válida
+ */
+void xlist_show(XList *list);
+
+/**
+ * @brief Coloca el cursor en el primer elemento de la lista.
+ *
+ * Si la lista está vacía el cursor queda al final.
+ *
+ * @param list Lista válida
+ * @param cursor Cursor a inicializar
+ *
+ * @return
+ * - LIST_OK si el cursor se inicializó correctamente
+ * - LIST_ERR_NULL si la lista o el cursor no existen
+ */
+ListStatus xlist_cursor_begin(XList *list, XListCursor *cursor);
+
+/**
+ * @brief Avanza el cursor al siguiente elemento.
+ *
+ * @param cursor Cursor válido
+ *
+ * @return
+ * - LIST_OK si el cursor avanzó
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor ya estaba al final
+ */
+ListStatus xlist_cursor_next(XListCursor *cursor);
+
+/**
+ * @brief Retrocede el cursor al elemento anterior.
+ *
+ * Desde el final de la lista el cursor pasa al último elemento.
+ *
+ * @param cursor Cursor válido
+ *
+ * @return
+ * - LIST_OK si el cursor retrocedió
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor ya estaba en el primer elemento
+ */
+ListStatus xlist_cursor_prev(XListCursor *cursor);
+
+/**
+ * @brief Devuelve el elemento bajo el cursor.
+ *
+ * @param cursor Cursor válido
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si se devolvió el elemento
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor está al final
+ */
+ListStatus xlist_cursor_get(XListCursor *cursor, int *value);
+
+/**
+ * @brief Reemplaza el elemento bajo el cursor.
+ *
+ * @param cursor Cursor válido
+ * @param value Nuevo elemento
+ *
+ * @return
+ * - LIST_OK si se reemplazó el elemento
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor está al final
+ */
+ListStatus xlist_cursor_set(XListCursor *cursor, int value);
+
+/**
+ * @brief Inserta un elemento antes del cursor, que sigue en el mismo elemento.
+ *
+ * Con el cursor al final el elemento se inserta al final de la lista.
+ *
+ * @param cursor Cursor válido
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus xlist_cursor_insert_before(XListCursor *cursor, int value);
+
+/**
+ * @brief Inserta un elemento después del cursor, que sigue en el mismo elemento.
+ *
+ * @param cursor Cursor válido
+ * @param value Elemento a insertar
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor está al final
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus xlist_cursor_insert_after(XListCursor *cursor, int value);
+
+/**
+ * @brief Elimina el elemento bajo el cursor y lo mueve al siguiente.
+ *
+ * @param cursor Cursor válido
+ *
+ * @return
+ * - LIST_OK si se eliminó el elemento
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor está al final
+ */
+ListStatus xlist_cursor_erase(XListCursor *cursor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XLIST_H */
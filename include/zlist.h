@@ -0,0 +1,298 @@
+#ifndef ZLIST_H
+#define ZLIST_H
+
+#include "list_status.h"
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Lista comprimida de enteros ordenados de menor a mayor (se permiten
+ * repetidos). Los elementos se guardan por bloques de ZLIST_CHUNK: el primero
+ * tal cual y los demás como la diferencia con el anterior codificada en
+ * varint (1 byte si la diferencia es menor que 128). Cada bloque conoce su
+ * mínimo, su máximo y su suma, así que contains salta los bloques que no
+ * pueden contener el valor y sum no decodifica nada.
+ *
+ * Solo se inserta al final. Las posiciones siguen la convención de slist.h.
+ */
+typedef struct ZList ZList;
+
+#define ZLIST_CHUNK 128 /**< Elementos por bloque */
+
+/**
+ * @brief Cursor para decodificar la lista en orden, en O(1) por paso.
+ *
+ * Sus campos son internos y no deben modificarse directamente. Insertar al
+ * final no invalida un cursor que aún no llega al final; zlist_clear sí.
+ */
+typedef struct ZListCursor {
+    ZList *list; /**< Lista recorrida */
+    size_t chunk; /**< Bloque actual (uso interno) */
+    size_t offset; /**< Byte del siguiente elemento dentro de la lista (uso interno) */
+    int index; /**< Elemento actual dentro del bloque (uso interno) */
+    int value; /**< Elemento actual (uso interno) */
+} ZListCursor;
+
+/**
+ * @brief Crea una lista comprimida.
+ *
+ * @return
+ * - Puntero a la lista si se creó correctamente
+ * - NULL si falla malloc
+ */
+ZList *zlist_create(void);
+
+/**
+ * @brief Obtiene el número de elementos en la lista.
+ *
+ * @param list Lista válida
+ * @param count Puntero donde se almacena el número de elementos
+ *
+ * @return
+ * - LIST_OK si se obtuvo el número de elementos correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus zlist_size(ZList *list, int *count);
+
+/**
+ * @brief Obtiene el tamaño de la lista en bytes (manejador, bloques y bytes codificados reservados).
+ *
+ * @param list Lista válida
+ * @param bytes Puntero donde se almacena el número de bytes
+ *
+ * @return
+ * - LIST_OK si se obtuvo el tamaño en bytes
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus zlist_size_bytes(ZList *list, size_t *bytes);
+
+/**
+ * @brief Determina si la lista está vacía.
+ *
+ * @param list Lista válida
+ * @param is_empty Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si se determinó el resultado
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus zlist_is_empty(ZList *list, bool *is_empty);
+
+/**
+ * @brief Busca un elemento en la lista.
+ *
+ * Busca por bisección el único bloque cuyo rango puede contener el valor y
+ * decodifica solo ese.
+ *
+ * @param list Lista válida
+ * @param value Elemento a buscar
+ * @param found Puntero donde se almacena el resultado
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró o no
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus zlist_contains(ZList *list, int value, bool *found);
+
+/**
+ * @brief Inserta un elemento al final de la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a insertar, mayor o igual que el último
+ *
+ * @return
+ * - LIST_OK si se insertó el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_ORDER si value es menor que el último elemento
+ * - LIST_ERR_ALLOC si malloc falla
+ */
+ListStatus zlist_push_back(ZList *list, int value);
+
+/**
+ * @brief Inserta al final los n elementos de un arreglo ordenado.
+ *
+ * El orden se valida y la memoria se reserva antes de codificar el primer
+ * elemento, así que si algo falla la lista no cambia.
+ *
+ * @param list Lista válida
+ * @param values Arreglo ordenado de menor a mayor
+ * @param n Número de elementos de values
+ *
+ * @return
+ * - LIST_OK si se insertaron todos los elementos
+ * - LIST_ERR_NULL si la lista no existe o values es NULL con n > 0
+ * - LIST_ERR_ORDER si values no está ordenado o empieza antes del último elemento
+ * - LIST_ERR_OUT_OF_RANGE si la lista superaría INT_MAX elementos
+ * - LIST_ERR_ALLOC si malloc falla (no se inserta ningún elemento)
+ */
+ListStatus zlist_extend(ZList *list, const int *values, size_t n);
+
+/**
+ * @brief Devuelve la posición de la primera aparición del elemento en la lista.
+ *
+ * @param list Lista válida
+ * @param value Elemento a buscar en la lista
+ * @param pos Puntero donde se almacena la posición
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_NOT_FOUND si no se encontró el elemento
+ */
+ListStatus zlist_search_for_value(ZList *list, int value, int *pos);
+
+/**
+ * @brief Devuelve el elemento en la posición solicitada
+ *
+ * Decodifica solo el bloque que contiene la posición.
+ *
+ * @param list Lista válida
+ * @param pos Posición solicitada
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si el elemento se encontró
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE posición fuera de rango
+ */
+ListStatus zlist_search_for_position(ZList *list, int pos, int *value);
+
+/**
+ * @brief Devuelve el primer elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si se devolvió el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus zlist_front(ZList *list, int *value);
+
+/**
+ * @brief Devuelve el último elemento de la lista.
+ *
+ * @param list Lista válida
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si se devolvió el elemento correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus zlist_back(ZList *list, int *value);
+
+/**
+ * @brief Vacía toda la lista.
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si la lista se vació correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus zlist_clear(ZList *list);
+
+/**
+ * @brief Suma todos los elementos de la lista a partir de la suma de cada bloque.
+ *
+ * @param list Lista válida
+ * @param sum Puntero donde se almacena la suma
+ *
+ * @return
+ * - LIST_OK si la suma se hizo correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ * - LIST_ERR_EMPTY si la lista está vacía
+ */
+ListStatus zlist_sum(ZList *list, int *sum);
+
+/**
+ * @brief Decodifica los elementos de la lista en un arreglo, en orden.
+ *
+ * Si cap es menor que el número de elementos se copian solo los primeros cap.
+ *
+ * @param list Lista válida
+ * @param out Arreglo de destino
+ * @param cap Capacidad de out
+ * @param written Puntero donde se almacena el número de elementos copiados
+ *
+ * @return
+ * - LIST_OK si se copió toda la lista
+ * - LIST_ERR_NULL si la lista, out o written no existen
+ * - LIST_ERR_EMPTY si la lista está vacía
+ * - LIST_ERR_OUT_OF_RANGE si out no alcanzó para toda la lista
+ */
+ListStatus zlist_to_array(ZList *list, int *out, size_t cap, size_t *written);
+
+/**
+ * @brief Destruye toda la lista.
+ *
+ * @param list Lista válida
+ *
+ * @return
+ * - LIST_OK si la lista se destruyó correctamente
+ * - LIST_ERR_NULL si la lista no existe o no fue creada
+ */
+ListStatus zlist_destroy(ZList *list);
+
+/**
+ * @brief Imprime la lista.
+ *
+ * @param list Lista válida
+ */
+void zlist_show(ZList *list);
+
+/**
+ * @brief Coloca el cursor en el primer elemento de la lista.
+ *
+ * Si la lista está vacía el cursor queda al final.
+ *
+ * @param list Lista válida
+ * @param cursor Cursor a inicializar
+ *
+ * @return
+ * - LIST_OK si el cursor se inicializó correctamente
+ * - LIST_ERR_NULL si la lista o el cursor no existen
+ */
+ListStatus zlist_cursor_begin(ZList *list, ZListCursor *cursor);
+
+/**
+ * @brief Avanza el cursor al siguiente elemento.
+ *
+ * @param cursor Cursor válido
+ *
+ * @return
+ * - LIST_OK si el cursor avanzó
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor ya estaba al final
+ */
+ListStatus zlist_cursor_next(ZListCursor *cursor);
+
+/**
+ * @brief Devuelve el elemento bajo el cursor.
+ *
+ * @param cursor Cursor válido
+ * @param value Puntero donde se almacena el elemento
+ *
+ * @return
+ * - LIST_OK si se devolvió el elemento
+ * - LIST_ERR_NULL si el cursor no existe
+ * - LIST_ERR_OUT_OF_RANGE si el cursor está al final
+ */
+ListStatus zlist_cursor_get(ZListCursor *cursor, int *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZLIST_H */
@@ -0,0 +1,168 @@
+#include "aggregate.h"
+#include <limits.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define AGGREGATE_X86 1
+#include <immintrin.h>
+#endif
+
+typedef void (*AggregateKernel)(const int *values, size_t n, unsigned flags, int value, ListAggregate *result);
+
+void aggregate_init(ListAggregate *result) {
+    result->sum = 0;
+    result->min = INT_MAX;
+    result->max = INT_MIN;
+    result->equal_count = 0;
+}
+
+static void aggregate_block_scalar(const int *values, size_t n, unsigned flags, int value, ListAggregate *result) {
+    long long sum = 0;
+    int min = result->min;
+    int max = result->max;
+    int equal_count = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        int v = values[i];
+
+        sum += v;
+        if (v < min) min = v;
+        if (v > max) max = v;
+        equal_count += (v == value);
+    }
+
+    if (flags & LIST_AGG_SUM) result->sum += sum;
+    if (flags & LIST_AGG_MIN) result->min = min;
+    if (flags & LIST_AGG_MAX) result->max = max;
+    if (flags & LIST_AGG_COUNT_EQUAL) result->equal_count += equal_count;
+}
+
+#ifdef AGGREGATE_X86
+
+/* SSE2 no tiene min/max de 32 bits con signo: se hacen con comparación y máscara. */
+static inline __m128i aggregate_min_sse2(__m128i a, __m128i b) {
+    __m128i greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+}
+
+static inline __m128i aggregate_max_sse2(__m128i a, __m128i b) {
+    __m128i greater = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+}
+
+static void aggregate_block_sse2(const int *values, size_t n, unsigned flags, int value, ListAggregate *result) {
+    size_t vec_n = n & ~(size_t)3; // múltiplo de 4 enteros
+    __m128i sum = _mm_setzero_si128(); // dos acumuladores de 64 bits
+    __m128i min = _mm_set1_epi32(result->min);
+    __m128i max = _mm_set1_epi32(result->max);
+    __m128i equal = _mm_setzero_si128(); // cuenta en negativo (máscaras de -1)
+    __m128i needle = _mm_set1_epi32(value);
+
+    for (size_t i = 0; i < vec_n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(values + i));
+        __m128i sign = _mm_srai_epi32(v, 31); // extensión de signo a 64 bits
+
+        sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(v, sign));
+        sum = _mm_add_epi64(sum, _mm_unpackhi_epi32(v, sign));
+        min = aggregate_min_sse2(min, v);
+        max = aggregate_max_sse2(max, v);
+        equal = _mm_sub_epi32(equal, _mm_cmpeq_epi32(v, needle));
+    }
+
+    long long sums[2];
+    int mins[4], maxs[4], equals[4];
+
+    _mm_storeu_si128((__m128i *)sums, sum);
+    _mm_storeu_si128((__m128i *)mins, min);
+    _mm_storeu_si128((__m128i *)maxs, max);
+    _mm_storeu_si128((__m128i *)equals, equal);
+
+    ListAggregate lanes = *result;
+
+    lanes.sum = sums[0] + sums[1];
+    lanes.equal_count = equals[0] + equals[1] + equals[2] + equals[3];
+    for (int i = 0; i < 4; i++) {
+        if (mins[i] < lanes.min) lanes.min = mins[i];
+        if (maxs[i] > lanes.max) lanes.max = maxs[i];
+    }
+
+    aggregate_block_scalar(values + vec_n, n - vec_n, flags, value, &lanes); // resto
+
+    if (flags & LIST_AGG_SUM) result->sum += lanes.sum;
+    if (flags & LIST_AGG_MIN) result->min = lanes.min;
+    if (flags & LIST_AGG_MAX) result->max = lanes.max;
+    if (flags & LIST_AGG_COUNT_EQUAL) result->equal_count += lanes.equal_count;
+}
+
+__attribute__((target("avx2")))
+static void aggregate_block_avx2(const int *values, size_t n, unsigned flags, int value, ListAggregate *result) {
+    size_t vec_n = n & ~(size_t)7; // múltiplo de 8 enteros
+    __m256i sum = _mm256_setzero_si256(); // cuatro acumuladores de 64 bits
+    __m256i min = _mm256_set1_epi32(result->min);
+    __m256i max = _mm256_set1_epi32(result->max);
+    __m256i equal = _mm256_setzero_si256(); // cuenta en negativo (máscaras de -1)
+    __m256i needle = _mm256_set1_epi32(value);
+
+    for (size_t i = 0; i < vec_n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(values + i));
+
+        sum = _mm256_add_epi64(sum, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        sum = _mm256_add_epi64(sum, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+        min = _mm256_min_epi32(min, v);
+        max = _mm256_max_epi32(max, v);
+        equal = _mm256_sub_epi32(equal, _mm256_cmpeq_epi32(v, needle));
+    }
+
+    long long sums[4];
+    int mins[8], maxs[8], equals[8];
+
+    _mm256_storeu_si256((__m256i *)sums, sum);
+    _mm256_storeu_si256((__m256i *)mins, min);
+    _mm256_storeu_si256((__m256i *)maxs, max);
+    _mm256_storeu_si256((__m256i *)equals, equal);
+
+    ListAggregate lanes = *result;
+
+    lanes.sum = sums[0] + sums[1] + sums[2] + sums[3];
+    lanes.equal_count = 0;
+    for (int i = 0; i < 8; i++) {
+        lanes.equal_count += equals[i];
+        if (mins[i] < lanes.min) lanes.min = mins[i];
+        if (maxs[i] > lanes.max) lanes.max = maxs[i];
+    }
+
+    aggregate_block_scalar(values + vec_n, n - vec_n, flags, value, &lanes); // resto
+
+    if (flags & LIST_AGG_SUM) result->sum += lanes.sum;
+    if (flags & LIST_AGG_MIN) result->min = lanes.min;
+    if (flags & LIST_AGG_MAX) result->max = lanes.max;
+    if (flags & LIST_AGG_COUNT_EQUAL) result->equal_count += lanes.equal_count;
+}
+
+static AggregateKernel aggregate_select(void) {
+    __builtin_cpu_init(); // consulta CPUID
+
+    if (__builtin_cpu_supports("avx2")) return aggregate_block_avx2;
+    if (__builtin_cpu_supports("sse2")) return aggregate_block_sse2;
+    return aggregate_block_scalar;
+}
+
+void aggregate_block(const int *values, size_t n, unsigned flags, int value, ListAggregate *result) {
+    static AggregateKernel kernel = NULL; // se elige una sola vez
+
+    AggregateKernel actual = __atomic_load_n(&kernel, __ATOMIC_RELAXED);
+
+    if (!actual) {
+        actual = aggregate_select();
+        __atomic_store_n(&kernel, actual, __ATOMIC_RELAXED);
+    }
+
+    actual(values, n, flags, value, result);
+}
+
+#else
+
+void aggregate_block(const int *values, size_t n, unsigned flags, int value, ListAggregate *result) {
+    aggregate_block_scalar(values, n, flags, value, result);
+}
+
+#endif
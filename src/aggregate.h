@@ -0,0 +1,24 @@
+#ifndef AGGREGATE_H
+#define AGGREGATE_H
+
+#include "list_aggregate.h"
+
+/*
+ * Núcleos internos para los agregados de las listas. Los recorridos copian
+ * los valores en un búfer de AGGREGATE_BLOCK enteros en la pila y lo reducen
+ * con aggregate_block, que usa AVX2, SSE2 o código escalar según la CPU.
+ */
+
+#define AGGREGATE_BLOCK 256 // enteros por búfer
+
+/**
+ * @brief Deja result listo para acumular (suma 0, min INT_MAX, max INT_MIN).
+ */
+void aggregate_init(ListAggregate *result);
+
+/**
+ * @brief Acumula en result los agregados pedidos en flags sobre values.
+ */
+void aggregate_block(const int *values, size_t n, unsigned flags, int value, ListAggregate *result);
+
+#endif /* AGGREGATE_H */
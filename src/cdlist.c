@@ -0,0 +1,425 @@
+#include "cdlist.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <sched.h>
+
+#include "epoch.h"
+
+#define CDLIST_LINE 64 // bytes por línea de caché
+#define CDLIST_SPINS 64 // vueltas de espera activa antes de ceder el procesador
+
+/*
+ * next, value y removed solo se leen o escriben con el candado del nodo.
+ * prev se lee también sin candado desde tail (push_back y pop_back), por
+ * eso se accede con operaciones atómicas.
+ */
+typedef struct Node {
+    int value;
+    unsigned char lock;
+    unsigned char removed; // 1 cuando el nodo ya se desenlazó
+    struct Node *next;
+    struct Node *prev;
+} Node;
+
+struct CDList {
+    Node head; // centinela antes del primer elemento
+    char pad_head[CDLIST_LINE - sizeof(Node)];
+    Node tail; // centinela después del último elemento
+    char pad_tail[CDLIST_LINE - sizeof(Node)];
+    int count; // contador relajado de elementos
+};
+
+static void cdlist_lock(Node *node) {
+    int spins = 0;
+
+    while (__atomic_exchange_n(&node->lock, 1, __ATOMIC_ACQUIRE)) {
+        while (__atomic_load_n(&node->lock, __ATOMIC_RELAXED)) { // esperamos sin escribir en la línea
+            if (++spins > CDLIST_SPINS) sched_yield();
+        }
+    }
+}
+
+static void cdlist_unlock(Node *node) {
+    __atomic_store_n(&node->lock, 0, __ATOMIC_RELEASE);
+}
+
+static inline Node *cdlist_prev(Node *node) {
+    return __atomic_load_n(&node->prev, __ATOMIC_ACQUIRE);
+}
+
+static inline void cdlist_set_prev(Node *node, Node *prev) {
+    __atomic_store_n(&node->prev, prev, __ATOMIC_RELEASE);
+}
+
+/*
+ * Recorre la lista con acoplamiento de candados hasta dejar bloqueados el
+ * nodo en pos - 1 (head si pos es 1) en *before y el nodo en pos (tail si
+ * pos es count + 1) en *actual. Si pos - 1 queda después del último
+ * elemento suelta todo y devuelve false. empty indica si la lista estaba
+ * vacía al empezar.
+ */
+static bool cdlist_lock_window(CDList *list, int pos, Node **before, Node **actual, bool *empty) {
+    Node *prev = &list->head;
+    Node *node;
+
+    cdlist_lock(prev);
+    node = prev->next;
+    cdlist_lock(node);
+    *empty = (node == &list->tail);
+
+    for (int i = 1; i < pos; i++) { // avanzamos soltando el candado de atrás
+        if (node == &list->tail) {
+            cdlist_unlock(node);
+            cdlist_unlock(prev);
+            return false;
+        }
+
+        cdlist_unlock(prev);
+        prev = node;
+        node = node->next;
+        cdlist_lock(node);
+    }
+
+    *before = prev;
+    *actual = node;
+    return true;
+}
+
+/* Enlaza new entre before y after, que están bloqueados y son vecinos. */
+static void cdlist_link(CDList *list, Node *before, Node *new, Node *after) {
+    new->next = after;
+    cdlist_set_prev(new, before);
+    before->next = new;
+    cdlist_set_prev(after, new);
+    __atomic_fetch_add(&list->count, 1, __ATOMIC_RELAXED);
+}
+
+/* Desenlaza node; before, node y after están bloqueados y son vecinos. */
+static void cdlist_unlink(CDList *list, Node *before, Node *node, Node *after) {
+    before->next = after;
+    cdlist_set_prev(after, before);
+    node->removed = 1;
+    __atomic_fetch_sub(&list->count, 1, __ATOMIC_RELAXED);
+}
+
+/* Error de una posición menor que 1: como en dlist, una lista vacía se reporta antes que el rango. */
+static ListStatus cdlist_bad_position(CDList *list) {
+    bool empty;
+
+    cdlist_lock(&list->head);
+    empty = (list->head.next == &list->tail);
+    cdlist_unlock(&list->head);
+    return empty ? LIST_ERR_EMPTY : LIST_ERR_OUT_OF_RANGE;
+}
+
+/* Elimina el nodo en pos; el nodo se libera por épocas porque push_back y pop_back lo pueden estar leyendo. */
+static ListStatus cdlist_remove_at(CDList *list, int pos, int *value) {
+    if (pos < 1) return cdlist_bad_position(list);
+
+    Node *before;
+    Node *actual;
+    bool empty;
+
+    if (!cdlist_lock_window(list, pos, &before, &actual, &empty)) {
+        return empty ? LIST_ERR_EMPTY : LIST_ERR_OUT_OF_RANGE;
+    }
+
+    if (actual == &list->tail) {
+        cdlist_unlock(actual);
+        cdlist_unlock(before);
+        return empty ? LIST_ERR_EMPTY : LIST_ERR_OUT_OF_RANGE;
+    }
+
+    Node *after = actual->next;
+
+    cdlist_lock(after);
+    if (value) *value = actual->value;
+    cdlist_unlink(list, before, actual, after);
+    cdlist_unlock(after);
+    cdlist_unlock(actual);
+    cdlist_unlock(before);
+
+    epoch_retire(actual, free);
+    return LIST_OK;
+}
+
+CDList *cdlist_create(void) {
+    CDList *list = malloc(sizeof(CDList)); // creamos la lista
+
+    if (!list) return NULL;
+
+    list->head.lock = 0;
+    list->head.removed = 0;
+    list->head.prev = NULL;
+    list->head.next = &list->tail;
+    list->tail.lock = 0;
+    list->tail.removed = 0;
+    list->tail.prev = &list->head;
+    list->tail.next = NULL;
+    list->count = 0;
+    return list;
+}
+
+ListStatus cdlist_size(CDList *list, int *count) {
+    if (!list) return LIST_ERR_NULL;
+
+    *count = __atomic_load_n(&list->count, __ATOMIC_RELAXED);
+    return LIST_OK;
+}
+
+ListStatus cdlist_is_empty(CDList *list, bool *is_empty) {
+    if (!list) return LIST_ERR_NULL;
+
+    cdlist_lock(&list->head);
+    *is_empty = (list->head.next == &list->tail);
+    cdlist_unlock(&list->head);
+    return LIST_OK;
+}
+
+ListStatus cdlist_contains(CDList *list, int value, bool *found) {
+    if (!list) return LIST_ERR_NULL;
+
+    Node *prev = &list->head;
+    Node *actual;
+
+    cdlist_lock(prev);
+    actual = prev->next;
+
+    if (actual == &list->tail) {
+        cdlist_unlock(prev);
+        return LIST_ERR_EMPTY;
+    }
+
+    cdlist_lock(actual);
+    *found = false;
+
+    while (actual != &list->tail) {
+        if (actual->value == value) { // se encuentra
+            *found = true;
+            break;
+        }
+
+        cdlist_unlock(prev);
+        prev = actual;
+        actual = actual->next;
+        cdlist_lock(actual);
+    }
+
+    cdlist_unlock(actual);
+    cdlist_unlock(prev);
+    return LIST_OK;
+}
+
+ListStatus cdlist_push_back(CDList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+
+    Node *new = malloc(sizeof(Node)); // nuevo nodo
+    if (!new) return LIST_ERR_ALLOC;
+
+    new->value = value;
+    new->lock = 0;
+    new->removed = 0;
+
+    if (epoch_enter() != LIST_OK) { // el último nodo se lee sin candado
+        free(new);
+        return LIST_ERR_ALLOC;
+    }
+
+    for (;;) {
+        Node *last = cdlist_prev(&list->tail);
+
+        cdlist_lock(last);
+        if (!last->removed && last->next == &list->tail) { // sigue siendo el último
+            cdlist_lock(&list->tail);
+            cdlist_link(list, last, new, &list->tail);
+            cdlist_unlock(&list->tail);
+            cdlist_unlock(last);
+            break;
+        }
+
+        cdlist_unlock(last); // otro hilo cambió el final: reintentamos
+    }
+
+    epoch_exit();
+    return LIST_OK;
+}
+
+ListStatus cdlist_push_front(CDList *list, int value) {
+    return cdlist_insert_in_position(list, value, 1);
+}
+
+ListStatus cdlist_insert_in_position(CDList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (pos < 1) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *new = malloc(sizeof(Node)); // número a insertar
+    if (!new) return LIST_ERR_ALLOC;
+
+    new->value = value;
+    new->lock = 0;
+    new->removed = 0;
+
+    Node *before;
+    Node *after;
+    bool empty;
+
+    if (!cdlist_lock_window(list, pos, &before, &after, &empty)) {
+        free(new);
+        return LIST_ERR_OUT_OF_RANGE;
+    }
+
+    cdlist_link(list, before, new, after);
+    cdlist_unlock(after);
+    cdlist_unlock(before);
+    return LIST_OK;
+}
+
+ListStatus cdlist_change_value(CDList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (pos < 1) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *before;
+    Node *actual;
+    bool empty;
+
+    if (!cdlist_lock_window(list, pos, &before, &actual, &empty)) return LIST_ERR_OUT_OF_RANGE;
+
+    ListStatus status = LIST_ERR_OUT_OF_RANGE;
+
+    if (actual != &list->tail) {
+        actual->value = value;
+        status = LIST_OK;
+    }
+
+    cdlist_unlock(actual);
+    cdlist_unlock(before);
+    return status;
+}
+
+ListStatus cdlist_search_for_position(CDList *list, int pos, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (pos < 1) return cdlist_bad_position(list);
+
+    Node *before;
+    Node *actual;
+    bool empty;
+
+    if (!cdlist_lock_window(list, pos, &before, &actual, &empty)) {
+        return empty ? LIST_ERR_EMPTY : LIST_ERR_OUT_OF_RANGE;
+    }
+
+    ListStatus status = empty ? LIST_ERR_EMPTY : LIST_ERR_OUT_OF_RANGE;
+
+    if (actual != &list->tail) {
+        *value = actual->value;
+        status = LIST_OK;
+    }
+
+    cdlist_unlock(actual);
+    cdlist_unlock(before);
+    return status;
+}
+
+ListStatus cdlist_free_in_position(CDList *list, int pos) {
+    if (!list) return LIST_ERR_NULL;
+
+    return cdlist_remove_at(list, pos, NULL);
+}
+
+ListStatus cdlist_pop_front(CDList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+
+    return cdlist_remove_at(list, 1, value);
+}
+
+ListStatus cdlist_pop_back(CDList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+    if (epoch_enter() != LIST_OK) return LIST_ERR_ALLOC; // el penúltimo nodo se lee sin candado
+
+    Node *last;
+
+    for (;;) {
+        last = cdlist_prev(&list->tail);
+
+        if (last == &list->head) {
+            epoch_exit();
+            return LIST_ERR_EMPTY;
+        }
+
+        Node *before = cdlist_prev(last);
+
+        cdlist_lock(before);
+        if (before->removed || before->next != last) { // otro hilo cambió el final: reintentamos
+            cdlist_unlock(before);
+            continue;
+        }
+
+        cdlist_lock(last); // no puede eliminarse mientras before está bloqueado
+        if (last->next != &list->tail) {
+            cdlist_unlock(last);
+            cdlist_unlock(before);
+            continue;
+        }
+
+        cdlist_lock(&list->tail);
+        *value = last->value;
+        cdlist_unlink(list, before, last, &list->tail);
+        cdlist_unlock(&list->tail);
+        cdlist_unlock(last);
+        cdlist_unlock(before);
+        break;
+    }
+
+    epoch_exit();
+    epoch_retire(last, free);
+    return LIST_OK;
+}
+
+ListStatus cdlist_sum(CDList *list, int *sum) {
+    if (!list) return LIST_ERR_NULL;
+
+    Node *prev = &list->head;
+    Node *actual;
+    int total = 0;
+
+    cdlist_lock(prev);
+    actual = prev->next;
+
+    if (actual == &list->tail) {
+        cdlist_unlock(prev);
+        return LIST_ERR_EMPTY;
+    }
+
+    cdlist_lock(actual);
+
+    while (actual != &list->tail) {
+        total += actual->value;
+
+        cdlist_unlock(prev);
+        prev = actual;
+        actual = actual->next;
+        cdlist_lock(actual);
+    }
+
+    cdlist_unlock(actual);
+    cdlist_unlock(prev);
+    *sum = total;
+    return LIST_OK;
+}
+
+ListStatus cdlist_destroy(CDList *list) {
+    if (!list) return LIST_ERR_NULL;
+
+    Node *actual = list->head.next;
+
+    while (actual != &list->tail) {
+        Node *next = actual->next;
+        free(actual);
+        actual = next;
+    }
+
+    free(list);
+    return LIST_OK;
+}
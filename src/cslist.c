@@ -0,0 +1,215 @@
+#include "cslist.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+
+#define CSLIST_LINE 64 // bytes por línea de caché
+#define CSLIST_FIRST_SHIFT 4
+#define CSLIST_FIRST_NODES (1u << CSLIST_FIRST_SHIFT) // nodos del primer segmento
+#define CSLIST_SEGMENTS 28 // el segmento k tiene CSLIST_FIRST_NODES << k nodos; 28 cubren INT_MAX
+
+/*
+ * Los nodos se direccionan con índices de 32 bits (0 es NULL) para que el
+ * índice y la versión quepan juntos en una palabra de 64 bits que se
+ * actualiza con un CAS normal. next es atómico porque un hilo puede leerlo
+ * mientras otro ya sacó el nodo y lo está reutilizando; en ese caso el CAS
+ * del primero falla por la versión y el valor leído se descarta.
+ */
+typedef struct Node {
+    int value;
+    uint32_t next;
+} Node;
+
+/*
+ * head, free_nodes y count van en líneas de caché distintas: cada
+ * operación escribe dos de ellas y compartir línea multiplicaría los fallos
+ * de caché entre hilos.
+ */
+struct CSList {
+    uint64_t head; // versión << 32 | índice del primer nodo
+    char pad_head[CSLIST_LINE - sizeof(uint64_t)];
+    uint64_t free_nodes; // nodos sacados, en otra pila con el mismo esquema
+    char pad_free[CSLIST_LINE - sizeof(uint64_t)];
+    int count; // contador relajado de elementos
+    char pad_count[CSLIST_LINE - sizeof(int)];
+    uint32_t used; // índices entregados alguna vez
+    Node *segments[CSLIST_SEGMENTS]; // se reservan al necesitarse y no se mueven
+};
+
+/* Segmento y desplazamiento del índice index (distinto de 0). */
+static inline unsigned cslist_segment_of(uint32_t index, uint32_t *offset) {
+    uint32_t i = index - 1 + CSLIST_FIRST_NODES;
+    unsigned k = 31 - (unsigned)__builtin_clz(i) - CSLIST_FIRST_SHIFT;
+
+    *offset = i - (CSLIST_FIRST_NODES << k);
+    return k;
+}
+
+/*
+ * El segmento de un índice recibido por head ya fue publicado por el hilo
+ * que reservó el nodo antes de su CAS, así que basta una lectura relajada.
+ */
+static inline Node *cslist_node(CSList *list, uint32_t index) {
+    uint32_t offset;
+    unsigned k = cslist_segment_of(index, &offset);
+
+    return __atomic_load_n(&list->segments[k], __ATOMIC_RELAXED) + offset;
+}
+
+static inline uint64_t cslist_word(uint64_t old, uint32_t index) {
+    return (((old >> 32) + 1) << 32) | index; // nueva versión con el nuevo índice
+}
+
+static void cslist_stack_push(CSList *list, uint64_t *top, uint32_t index) {
+    Node *node = cslist_node(list, index);
+    uint64_t old = __atomic_load_n(top, __ATOMIC_RELAXED);
+
+    do {
+        __atomic_store_n(&node->next, (uint32_t)old, __ATOMIC_RELAXED);
+    } while (!__atomic_compare_exchange_n(top, &old, cslist_word(old, index), true,
+                                          __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+/* Saca el nodo de la cima de top; devuelve 0 si está vacía. */
+static uint32_t cslist_stack_pop(CSList *list, uint64_t *top) {
+    uint64_t old = __atomic_load_n(top, __ATOMIC_ACQUIRE);
+
+    for (;;) {
+        uint32_t index = (uint32_t)old;
+        if (!index) return 0;
+
+        uint32_t next = __atomic_load_n(&cslist_node(list, index)->next, __ATOMIC_RELAXED);
+
+        if (__atomic_compare_exchange_n(top, &old, cslist_word(old, next), true,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+            return index;
+        }
+    }
+}
+
+/* Devuelve el segmento k, reservándolo si nadie lo ha hecho; NULL si falla malloc. */
+static Node *cslist_segment(CSList *list, unsigned k) {
+    Node *segment = __atomic_load_n(&list->segments[k], __ATOMIC_ACQUIRE);
+    if (segment) return segment;
+
+    Node *new = malloc(((size_t)CSLIST_FIRST_NODES << k) * sizeof(Node));
+    if (!new) return NULL;
+
+    Node *expected = NULL;
+
+    if (!__atomic_compare_exchange_n(&list->segments[k], &expected, new, false,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        free(new); // otro hilo lo reservó primero
+        return expected;
+    }
+
+    return new;
+}
+
+/* Devuelve un nodo libre o 0 con el error en status. */
+static uint32_t cslist_node_alloc(CSList *list, ListStatus *status) {
+    uint32_t index = cslist_stack_pop(list, &list->free_nodes); // reutilizamos un nodo sacado
+
+    if (index) return index;
+
+    uint32_t used = __atomic_load_n(&list->used, __ATOMIC_RELAXED);
+
+    do {
+        if (used == INT_MAX) {
+            *status = LIST_ERR_OUT_OF_RANGE;
+            return 0;
+        }
+    } while (!__atomic_compare_exchange_n(&list->used, &used, used + 1, true,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+    index = used + 1;
+
+    uint32_t offset;
+    if (!cslist_segment(list, cslist_segment_of(index, &offset))) {
+        *status = LIST_ERR_ALLOC; // el índice queda sin usar
+        return 0;
+    }
+
+    return index;
+}
+
+CSList *cslist_create(void) {
+    CSList *list = malloc(sizeof(CSList)); // creamos la lista
+
+    if (!list) return NULL;
+
+    list->head = 0;
+    list->free_nodes = 0;
+    list->count = 0;
+    list->used = 0;
+    for (int k = 0; k < CSLIST_SEGMENTS; k++) list->segments[k] = NULL;
+    return list;
+}
+
+ListStatus cslist_size(CSList *list, int *count) {
+    if (!list) return LIST_ERR_NULL;
+
+    *count = __atomic_load_n(&list->count, __ATOMIC_RELAXED);
+    return LIST_OK;
+}
+
+ListStatus cslist_size_bytes(CSList *list, size_t *bytes) {
+    if (!list) return LIST_ERR_NULL;
+    if (!bytes) return LIST_ERR_NULL;
+
+    size_t total = sizeof(CSList);
+
+    for (unsigned k = 0; k < CSLIST_SEGMENTS; k++) { // segmentos reservados
+        if (__atomic_load_n(&list->segments[k], __ATOMIC_RELAXED)) {
+            total += ((size_t)CSLIST_FIRST_NODES << k) * sizeof(Node);
+        }
+    }
+
+    *bytes = total;
+    return LIST_OK;
+}
+
+ListStatus cslist_is_empty(CSList *list, bool *is_empty) {
+    if (!list) return LIST_ERR_NULL;
+
+    *is_empty = (uint32_t)__atomic_load_n(&list->head, __ATOMIC_RELAXED) == 0;
+    return LIST_OK;
+}
+
+ListStatus cslist_push_front(CSList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+
+    ListStatus status = LIST_OK;
+    uint32_t new = cslist_node_alloc(list, &status); // nuevo nodo
+    if (!new) return status;
+
+    cslist_node(list, new)->value = value; // el nodo aún es solo nuestro
+    cslist_stack_push(list, &list->head, new);
+    __atomic_fetch_add(&list->count, 1, __ATOMIC_RELAXED);
+    return LIST_OK;
+}
+
+ListStatus cslist_pop_front(CSList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+
+    uint32_t actual = cslist_stack_pop(list, &list->head);
+    if (!actual) return LIST_ERR_EMPTY;
+
+    *value = cslist_node(list, actual)->value;
+    cslist_stack_push(list, &list->free_nodes, actual); // queda para reutilizarse
+    __atomic_fetch_sub(&list->count, 1, __ATOMIC_RELAXED);
+    return LIST_OK;
+}
+
+ListStatus cslist_destroy(CSList *list) {
+    if (!list) return LIST_ERR_NULL;
+
+    for (int k = 0; k < CSLIST_SEGMENTS; k++) {
+        free(list->segments[k]);
+    }
+
+    free(list);
+    return LIST_OK;
+}
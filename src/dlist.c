@@ -2,6 +2,18 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <limits.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "aggregate.h"
+#include "node_pool.h"
+#include "par_pool.h"
+#include "prefetch.h"
+#include "run_sort.h"
+#include "snapshot.h"
+#include "value_index.h"
 
 typedef struct Node {
     int value;
@@ -9,10 +21,52 @@ typedef struct Node {
     struct Node *prev;
 } Node;
 
+#define DLIST_INDEX_MAX_LEVEL 16 // niveles de carriles exprés
+#define DLIST_INDEX_WALK 16 // distancia que conviene recorrer sin usar el índice
+#define DLIST_SORT_WAYS 8 // cadenas que mezcla a la vez el merge sort
+#define DLIST_RADIX_BITS 8 // bits por dígito del radix sort
+#define DLIST_RADIX_BUCKETS (1 << DLIST_RADIX_BITS)
+#define DLIST_RADIX_MAX_THREADS 64
+#define DLIST_RADIX_MIN_CHUNK 65536 // elementos mínimos por hilo
+#define DLIST_SORT_LEVELS 11 // niveles del contador del merge sort (DLIST_SORT_WAYS^11 tramos)
+#define DLIST_PAR_SPLIT 4 // tramos por hilo en los recorridos en paralelo, para que haya qué robar
+#define DLIST_PAR_MIN_CHUNK 16384 // elementos mínimos por tramo
+#define DLIST_PAR_CHECK 1024 // nodos entre consultas de si otro hilo ya encontró el valor
+
+typedef struct Lane Lane;
+
+typedef struct LaneLink {
+    Lane *next; // siguiente carril en el mismo nivel
+    int width; // posiciones que salta el enlace (hasta count + 1 si next es NULL)
+} LaneLink;
+
+/*
+ * Carril exprés de la lista indexada. Solo algunos nodos tienen carril, con
+ * una altura aleatoria; la cabecera representa la posición 0.
+ */
+struct Lane {
+    Node *node; // nodo base (NULL en la cabecera)
+    int height;
+    LaneLink links[];
+};
+
+typedef struct DListIndex {
+    Lane *header; // cabecera con DLIST_INDEX_MAX_LEVEL niveles
+    int levels; // niveles en uso
+    unsigned seed; // estado del generador de alturas
+    size_t bytes; // memoria de la cabecera y los carriles
+    bool dirty; // los carriles no corresponden a la lista y hay que reconstruirlos
+} DListIndex;
+
 struct DList {
     Node *head;
     Node *tail;
     int count;
+    NodePool *pool; // NULL si los nodos se reservan con malloc
+    ValueIndex *values; // índice hash por valor (NULL si no se usa)
+    Node *finger; // último nodo accedido por posición (NULL si no hay)
+    int finger_pos; // posición de finger
+    DListIndex *index; // carriles exprés (NULL si la lista no es indexada)
 };
 
 DList *dlist_create(void) {
@@ -23,9 +77,379 @@ DList *dlist_create(void) {
     list->head = NULL;
     list->tail = NULL;
     list->count = 0;
+    list->pool = NULL;
+    list->values = NULL;
+    list->finger = NULL;
+    list->finger_pos = 0;
+    list->index = NULL;
+    return list;
+}
+
+DList *dlist_create_pooled(size_t block_nodes) {
+    DList *list = dlist_create(); // creamos la lista
+
+    if (!list) return NULL;
+
+    list->pool = node_pool_create(sizeof(Node), block_nodes);
+    if (!list->pool) {
+        free(list);
+        return NULL;
+    }
+
+    return list;
+}
+
+DList *dlist_create_indexed(void) {
+    DList *list = dlist_create(); // creamos la lista
+
+    if (!list) return NULL;
+
+    DListIndex *index = malloc(sizeof(DListIndex));
+    size_t header_bytes = sizeof(Lane) + DLIST_INDEX_MAX_LEVEL * sizeof(LaneLink);
+    Lane *header = malloc(header_bytes);
+
+    if (!index || !header) {
+        free(index);
+        free(header);
+        free(list);
+        return NULL;
+    }
+
+    header->node = NULL;
+    header->height = DLIST_INDEX_MAX_LEVEL;
+    header->links[0].next = NULL;
+    header->links[0].width = 1; // count + 1 con la lista vacía
+
+    index->header = header;
+    index->levels = 1;
+    index->seed = 0x9E3779B9u;
+    index->bytes = sizeof(DListIndex) + header_bytes;
+    index->dirty = false;
+    list->index = index;
     return list;
 }
 
+/* Altura del carril de un nodo nuevo: 0 (sin carril) con probabilidad 3/4. */
+static int dlist_index_height(DListIndex *index) {
+    int height = 0;
+
+    while (height < DLIST_INDEX_MAX_LEVEL - 1) {
+        index->seed ^= index->seed << 13; // xorshift32
+        index->seed ^= index->seed >> 17;
+        index->seed ^= index->seed << 5;
+
+        if (index->seed & 3) break;
+        height++;
+    }
+
+    return height;
+}
+
+static Lane *dlist_index_lane_create(DListIndex *index, Node *node, int height) {
+    size_t bytes = sizeof(Lane) + height * sizeof(LaneLink);
+    Lane *lane = malloc(bytes);
+
+    if (!lane) return NULL;
+
+    lane->node = node;
+    lane->height = height;
+    index->bytes += bytes;
+    return lane;
+}
+
+static void dlist_index_lane_free(DListIndex *index, Lane *lane) {
+    index->bytes -= sizeof(Lane) + lane->height * sizeof(LaneLink);
+    free(lane);
+}
+
+/* Libera todos los carriles y deja la cabecera apuntando al final. */
+static void dlist_index_drop(DList *list) {
+    DListIndex *index = list->index;
+    Lane *lane = index->header->links[0].next;
+    Lane *next = NULL;
+
+    while (lane) { // todos los carriles aparecen en el nivel 0
+        next = lane->links[0].next;
+        dlist_index_lane_free(index, lane);
+        lane = next;
+    }
+
+    index->header->links[0].next = NULL;
+    index->header->links[0].width = list->count + 1;
+    index->levels = 1;
+}
+
+/* Reconstruye los carriles recorriendo la lista una vez, en O(n). */
+static void dlist_index_rebuild(DList *list) {
+    DListIndex *index = list->index;
+    Lane *last[DLIST_INDEX_MAX_LEVEL]; // último carril de cada nivel
+    int last_rank[DLIST_INDEX_MAX_LEVEL];
+    int rank = 1;
+
+    dlist_index_drop(list);
+
+    for (int l = 0; l < DLIST_INDEX_MAX_LEVEL; l++) {
+        last[l] = index->header;
+        last_rank[l] = 0;
+    }
+
+    for (Node *actual = list->head; actual; actual = actual->next, rank++) {
+        int height = dlist_index_height(index);
+        if (!height) continue;
+
+        Lane *lane = dlist_index_lane_create(index, actual, height);
+        if (!lane) break; // sin memoria el índice queda parcial, pero válido
+
+        for (int l = 0; l < height; l++) {
+            last[l]->links[l].next = lane;
+            last[l]->links[l].width = rank - last_rank[l];
+            last[l] = lane;
+            last_rank[l] = rank;
+        }
+
+        if (height > index->levels) index->levels = height;
+    }
+
+    for (int l = 0; l < index->levels; l++) { // los últimos apuntan al final
+        last[l]->links[l].next = NULL;
+        last[l]->links[l].width = list->count + 1 - last_rank[l];
+    }
+
+    index->dirty = false;
+}
+
+/*
+ * Guarda en update el carril más a la derecha con posición menor que pos en
+ * cada nivel, y su posición en rank.
+ */
+static void dlist_index_path(DListIndex *index, int pos, int levels, Lane **update, int *rank) {
+    Lane *actual = index->header;
+    int actual_rank = 0;
+
+    for (int l = levels - 1; l >= 0; l--) {
+        while (actual->links[l].next && actual_rank + actual->links[l].width < pos) {
+            actual_rank += actual->links[l].width;
+            actual = actual->links[l].next;
+        }
+
+        update[l] = actual;
+        rank[l] = actual_rank;
+    }
+}
+
+/* Devuelve el nodo en la posición pos usando los carriles, en O(log n) esperado. */
+static Node *dlist_index_locate(DList *list, int pos) {
+    DListIndex *index = list->index;
+
+    if (index->dirty) dlist_index_rebuild(list);
+
+    Lane *actual = index->header;
+    int actual_rank = 0;
+
+    for (int l = index->levels - 1; l >= 0; l--) {
+        while (actual->links[l].next && actual_rank + actual->links[l].width <= pos) {
+            actual_rank += actual->links[l].width;
+            actual = actual->links[l].next;
+        }
+    }
+
+    Node *node = actual->node ? actual->node : list->head;
+    if (!actual->node) actual_rank = 1;
+
+    while (actual_rank < pos) { // el resto se recorre por la lista base
+        node = node->next;
+        actual_rank++;
+    }
+
+    return node;
+}
+
+/* Registra en los carriles un nodo ya enlazado en pos (count ya incluye el nodo). */
+static void dlist_index_insert(DList *list, Node *node, int pos) {
+    DListIndex *index = list->index;
+    Lane *update[DLIST_INDEX_MAX_LEVEL];
+    int rank[DLIST_INDEX_MAX_LEVEL];
+    int height = dlist_index_height(index);
+
+    if (index->dirty) return; // se reconstruirá en el próximo acceso
+
+    for (int l = index->levels; l < height; l++) { // niveles nuevos apuntan al final
+        index->header->links[l].next = NULL;
+        index->header->links[l].width = list->count; // count + 1 antes de insertar
+    }
+
+    int levels = height > index->levels ? height : index->levels;
+    Lane *lane = NULL;
+
+    if (height) {
+        lane = dlist_index_lane_create(index, node, height);
+        if (!lane) { // sin memoria para el carril: reconstruimos después
+            index->dirty = true;
+            return;
+        }
+    }
+
+    dlist_index_path(index, pos, levels, update, rank);
+
+    for (int l = 0; l < levels; l++) {
+        LaneLink *link = &update[l]->links[l];
+
+        if (l < height) { // el carril nuevo parte el enlace en dos
+            lane->links[l].next = link->next;
+            lane->links[l].width = rank[l] + link->width + 1 - pos;
+            link->next = lane;
+            link->width = pos - rank[l];
+        } else { // el enlace salta una posición más
+            link->width++;
+        }
+    }
+
+    index->levels = levels;
+}
+
+/* Quita de los carriles el nodo en pos, antes de desenlazarlo. */
+static void dlist_index_remove(DList *list, int pos) {
+    DListIndex *index = list->index;
+    Lane *update[DLIST_INDEX_MAX_LEVEL];
+    int rank[DLIST_INDEX_MAX_LEVEL];
+    Lane *removed = NULL;
+
+    if (index->dirty) return; // se reconstruirá en el próximo acceso
+
+    dlist_index_path(index, pos, index->levels, update, rank);
+
+    for (int l = 0; l < index->levels; l++) {
+        LaneLink *link = &update[l]->links[l];
+
+        if (link->next && rank[l] + link->width == pos) { // el carril del nodo sale
+            removed = link->next;
+            link->width += removed->links[l].width - 1;
+            link->next = removed->links[l].next;
+        } else {
+            link->width--;
+        }
+    }
+
+    if (removed) dlist_index_lane_free(index, removed);
+
+    while (index->levels > 1 && !index->header->links[index->levels - 1].next) {
+        index->levels--;
+    }
+}
+
+static void dlist_index_destroy(DList *list) {
+    if (!list->index) return;
+
+    dlist_index_drop(list);
+    free(list->index->header);
+    free(list->index);
+    list->index = NULL;
+}
+
+ListStatus dlist_enable_value_index(DList *list) {
+    if (!list) return LIST_ERR_NULL;
+    if (list->values) return LIST_OK; // ya existe
+
+    ValueIndex *values = value_index_create();
+    if (!values) return LIST_ERR_ALLOC;
+
+    for (Node *actual = list->head; actual; actual = actual->next) { // registramos lo que ya hay
+        if (!value_index_add(values, actual->value)) {
+            value_index_destroy(values);
+            return LIST_ERR_ALLOC;
+        }
+    }
+
+    list->values = values;
+    return LIST_OK;
+}
+
+static Node *dlist_node_alloc(DList *list) {
+    if (list->pool) return node_pool_alloc(list->pool);
+
+    return malloc(sizeof(Node));
+}
+
+static void dlist_node_release(DList *list, Node *node) {
+    if (list->pool) {
+        node_pool_release(list->pool, node);
+        return;
+    }
+
+    free(node);
+}
+
+/* Registra value en el índice por valor; sin memoria el índice se descarta. */
+static void dlist_values_add(DList *list, int value) {
+    if (list->values && !value_index_add(list->values, value)) {
+        value_index_destroy(list->values);
+        list->values = NULL;
+    }
+}
+
+static void dlist_values_remove(DList *list, int value) {
+    if (list->values) value_index_remove(list->values, value);
+}
+
+/* Cambia el valor de node manteniendo el índice por valor. */
+static void dlist_node_set(DList *list, Node *node, int value) {
+    dlist_values_remove(list, node->value);
+    node->value = value;
+    dlist_values_add(list, value);
+}
+
+/*
+ * Enlaza new en la posición pos, justo antes de next (NULL para enlazarlo al
+ * final). Todas las inserciones pasan por aquí para mantener head, tail,
+ * count y el dedo.
+ */
+static void dlist_link(DList *list, Node *new, Node *next, int pos) {
+    Node *prev = next ? next->prev : list->tail;
+
+    new->prev = prev;
+    new->next = next;
+
+    if (prev) prev->next = new;
+    else list->head = new; // nuevo head
+
+    if (next) next->prev = new;
+    else list->tail = new; // nuevo tail
+
+    if (list->finger && list->finger_pos >= pos) list->finger_pos++; // el dedo se recorre
+    list->count++;
+    dlist_values_add(list, new->value);
+
+    if (list->index) dlist_index_insert(list, new, pos);
+}
+
+/*
+ * Desenlaza node, que ocupa la posición pos, sin liberarlo. Si el dedo
+ * apuntaba a node pasa al nodo que ahora ocupa pos, o al anterior si node
+ * era el último.
+ */
+static void dlist_unlink(DList *list, Node *node, int pos) {
+    Node *before_node = node->prev;
+    Node *after_node = node->next;
+
+    if (list->index) dlist_index_remove(list, pos);
+
+    if (before_node) before_node->next = after_node; // unimos las listas
+    else list->head = after_node; // era el primero
+
+    if (after_node) after_node->prev = before_node; // unimos las listas
+    else list->tail = before_node; // era el último
+
+    if (list->finger == node) {
+        list->finger = after_node ? after_node : before_node;
+        list->finger_pos = after_node ? pos : pos - 1;
+    } else if (list->finger && list->finger_pos > pos) {
+        list->finger_pos--;
+    }
+
+    list->count--;
+    dlist_values_remove(list, node->value);
+}
+
 ListStatus dlist_size(DList *list, int *count) {
     if (!list) return LIST_ERR_NULL;
 
@@ -37,7 +461,16 @@ ListStatus dlist_size_bytes(DList *list, size_t *bytes) {
     if (!list) return LIST_ERR_NULL;
     if (!bytes) return LIST_ERR_NULL;
 
-    *bytes = sizeof(DList) + list->count * sizeof(Node); // tamaño de DList + tamaño de todos los Node
+    size_t values_bytes = list->values ? value_index_bytes(list->values) : 0; // índice por valor
+
+    size_t index_bytes = list->index ? list->index->bytes : 0; // carriles exprés
+
+    if (list->pool) { // tamaño de DList + slabs del pool
+        *bytes = sizeof(DList) + node_pool_bytes(list->pool) + values_bytes + index_bytes;
+        return LIST_OK;
+    }
+
+    *bytes = sizeof(DList) + list->count * sizeof(Node) + values_bytes + index_bytes; // tamaño de DList + tamaño de todos los Node
     return LIST_OK;
 }
 
@@ -52,6 +485,11 @@ ListStatus dlist_contains(DList *list, int value, bool *found) {
     if (!list) return LIST_ERR_NULL;
     if (!list->head) return LIST_ERR_EMPTY;
 
+    if (list->values) { // respuesta directa del índice
+        *found = value_index_count(list->values, value) > 0;
+        return LIST_OK;
+    }
+
     Node *actual = list->head;
 
     while (actual) { // mover actual a la posición
@@ -70,49 +508,118 @@ ListStatus dlist_contains(DList *list, int value, bool *found) {
 ListStatus dlist_push_back(DList *list, int value) {
     if (!list) return LIST_ERR_NULL;
 
-    Node *new = malloc(sizeof(Node)); // nuevo nodo
+    Node *new = dlist_node_alloc(list); // nuevo nodo
     if (!new) return LIST_ERR_ALLOC;
 
     new->value = value;
-    new->next = NULL;
-    new->prev = NULL;
-
-    if (!list->head) { // lista vacía
-        list->head = new;
-        list->tail = new;
-    } else {
-        list->tail->next = new;
-        new->prev = list->tail;
-        list->tail = new;
-    }
-
-    list->count++;
+    dlist_link(list, new, NULL, list->count + 1); // enlazamos después de tail
     return LIST_OK;
 }
 
 ListStatus dlist_push_front(DList *list, int value) {
     if (!list) return LIST_ERR_NULL;
 
-    Node *new = malloc(sizeof(Node)); // nuevo nodo
+    Node *new = dlist_node_alloc(list); // nuevo nodo
     if (!new) return LIST_ERR_ALLOC;
 
     new->value = value;
-    new->next = NULL;
-    new->prev = NULL;
+    dlist_link(list, new, list->head, 1); // enlazamos como head
+    return LIST_OK;
+}
 
-    if (!list->head) { // lista vacía
-        list->head = new;
-        list->tail = new;
-    } else {
-        list->head->prev = new;
-        new->next = list->head;
-        list->head = new;
+/*
+ * Reserva n nodos con los valores de values y los deja enlazados entre sí.
+ * En una lista con pool los nodos salen de un único bloque contiguo; si no,
+ * de un malloc por nodo. Si falla una reserva no queda nada reservado.
+ */
+static Node *dlist_chain_create(DList *list, const int *values, size_t n, Node **last) {
+    Node *first = NULL;
+
+    if (list->pool) {
+        Node *run = node_pool_alloc_run(list->pool, n); // bloque de n nodos
+        if (!run) return NULL;
+
+        run[0].prev = NULL;
+        for (size_t i = 0; i < n - 1; i++) { // enlazamos el bloque
+            run[i].value = values[i];
+            run[i].next = &run[i + 1];
+            run[i + 1].prev = &run[i];
+        }
+
+        run[n - 1].value = values[n - 1];
+        run[n - 1].next = NULL;
+        *last = &run[n - 1];
+        return run;
     }
 
-    list->count++;
+    Node *prev = NULL;
+
+    for (size_t i = 0; i < n; i++) {
+        Node *new = malloc(sizeof(Node)); // nuevo nodo
+
+        if (!new) { // liberamos lo que ya se reservó
+            while (first) {
+                prev = first->next;
+                free(first);
+                first = prev;
+            }
+
+            return NULL;
+        }
+
+        new->value = values[i];
+        new->next = NULL;
+        new->prev = prev;
+
+        if (prev) prev->next = new;
+        else first = new;
+        prev = new;
+    }
+
+    *last = prev;
+    return first;
+}
+
+static ListStatus dlist_extend_at(DList *list, const int *values, size_t n, bool front) {
+    if (!list) return LIST_ERR_NULL;
+    if (n == 0) return LIST_OK;
+    if (!values) return LIST_ERR_NULL;
+    if (n > (size_t)(INT_MAX - list->count)) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *last = NULL;
+    Node *first = dlist_chain_create(list, values, n, &last);
+    if (!first) return LIST_ERR_ALLOC;
+
+    if (front) { // la cadena queda antes de head
+        last->next = list->head;
+        if (list->head) list->head->prev = last;
+        else list->tail = last;
+        list->head = first;
+
+        if (list->finger) list->finger_pos += (int)n; // el dedo se recorre n posiciones
+    } else { // la cadena queda después de tail
+        first->prev = list->tail;
+        if (list->tail) list->tail->next = first;
+        else list->head = first;
+        list->tail = last;
+    }
+
+    list->count += (int)n;
+    for (size_t i = 0; i < n; i++) {
+        dlist_values_add(list, values[i]);
+    }
+    if (list->index) list->index->dirty = true; // se reconstruye en el próximo acceso
     return LIST_OK;
 }
 
+ListStatus dlist_extend(DList *list, const int *values, size_t n) {
+    return dlist_extend_at(list, values, n, false);
+}
+
+ListStatus dlist_extend_front(DList *list, const int *values, size_t n) {
+    return dlist_extend_at(list, values, n, true);
+}
+
 static ListStatus dlist_validate_position(DList *list, int pos, int cond) {
     if (cond == 0) {
         if (pos > list->count + 1 || pos < 1) return LIST_ERR_OUT_OF_RANGE;
@@ -123,6 +630,48 @@ static ListStatus dlist_validate_position(DList *list, int pos, int cond) {
     return LIST_OK;
 }
 
+/*
+ * Devuelve el nodo en la posición pos (ya validada). Parte del extremo o del
+ * dedo más cercano y deja el dedo apuntando al nodo encontrado, de modo que
+ * los accesos consecutivos por posición cuestan O(1).
+ */
+static Node *dlist_node_at(DList *list, int pos) {
+    Node *actual = list->head;
+    int actual_pos = 1;
+    int distance = pos - 1; // distancia desde head
+
+    if (list->count - pos < distance) { // tail está más cerca
+        actual = list->tail;
+        actual_pos = list->count;
+        distance = list->count - pos;
+    }
+
+    if (list->finger && abs(pos - list->finger_pos) < distance) { // el dedo está más cerca
+        actual = list->finger;
+        actual_pos = list->finger_pos;
+        distance = abs(pos - list->finger_pos);
+    }
+
+    if (list->index && distance > DLIST_INDEX_WALK) { // lejos de todo: usamos los carriles
+        actual = dlist_index_locate(list, pos);
+        actual_pos = pos;
+    }
+
+    while (actual_pos < pos) { // avanzar hacia tail
+        actual = actual->next;
+        actual_pos++;
+    }
+
+    while (actual_pos > pos) { // retroceder hacia head
+        actual = actual->prev;
+        actual_pos--;
+    }
+
+    list->finger = actual;
+    list->finger_pos = pos;
+    return actual;
+}
+
 ListStatus dlist_insert_in_position(DList *list, int value, int pos) {
     if (!list) return LIST_ERR_NULL;
     if (dlist_validate_position(list, pos, 0) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
@@ -136,23 +685,15 @@ ListStatus dlist_insert_in_position(DList *list, int value, int pos) {
     }
 
     // cualquiera entre head y tail
-    Node *new = malloc(sizeof(Node)); // número a insertar
+    Node *new = dlist_node_alloc(list); // número a insertar
     if (!new) return LIST_ERR_ALLOC;
     new->value = value;
 
-    Node *before_new = list->head; // posición antes del la indicada
-
-    int i = 1;
-    while (before_new && i < pos - 1) { // mover before_new antes de pos
-        before_new = before_new->next;
-        i++;
-    }
+    Node *after_new = dlist_node_at(list, pos); // nodo que ocupa pos
 
-    new->next = before_new->next; // apuntamos al siguiente de new
-    before_new->next->prev = new; // apuntamos el siguiente de new a new
-    new->prev = before_new; // apuntamos a before_new
-    before_new->next = new; // apuntamos a new
-    list->count++;
+    dlist_link(list, new, after_new, pos);
+    list->finger = new; // new ocupa ahora pos
+    list->finger_pos = pos;
     return LIST_OK;
 }
 
@@ -160,19 +701,16 @@ ListStatus dlist_change_value(DList *list, int value, int pos) {
     if (!list) return LIST_ERR_NULL;
     if (dlist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
 
-    Node *actual = list->head;
-
-    for (int i = 0; i < pos - 1; i++) { // mover actual a la posición
-        actual = actual->next;
-    }
+    Node *actual = dlist_node_at(list, pos); // mover actual a la posición
 
-    actual->value = value;
+    dlist_node_set(list, actual, value);
     return LIST_OK;
 }
 
 ListStatus dlist_search_for_value(DList *list, int value, int *pos) {
     if (!list) return LIST_ERR_NULL;
     if (!list->head) return LIST_ERR_EMPTY;
+    if (list->values && !value_index_count(list->values, value)) return LIST_ERR_NOT_FOUND;
 
     Node *actual = list->head;
     int pos_local = 0;
@@ -201,13 +739,7 @@ ListStatus dlist_search_for_position(DList *list, int pos, int *value) {
     if (!list->head) return LIST_ERR_EMPTY;
     if (dlist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
 
-    Node *actual = list->head;
-
-    int i = 1;
-    while (actual && i < pos) { // mover actual a pos
-        actual = actual->next;
-        i++;
-    }
+    Node *actual = dlist_node_at(list, pos); // mover actual a pos
 
     *value = actual->value;
     return LIST_OK;
@@ -233,107 +765,1154 @@ ListStatus dlist_free_in_position(DList *list, int pos) {
     if (!list) return LIST_ERR_NULL;
     if (!list->head) return LIST_ERR_EMPTY;
 
-    Node *actual = list->head;
-    Node *after_actual = NULL;
-    Node *before_actual = NULL;
-
-    if (pos == list->count) { // último de la lista
-        int i = 1;
-        while (actual && i < pos - 1) { // mover actual antes de pos
-            actual = actual->next;
-            i++;
-        }
-
-        after_actual = actual->next; // apuntamos al último
-        free(after_actual); // liberamos al último
-
-        list->tail = actual; // actualizamos tail
-        list->tail->next = NULL; // apuntamos a NULL
-        list->count--;
-        return LIST_OK;
-    }
-
-    if (pos == 1) { // primero de la lista
-        actual = list->head;
-        list->head = list->head->next; // actualizamos head
-        free(actual); // liberamos al primero
-        list->head->prev = NULL;
-        list->count--;
-        return LIST_OK;
-    }
-
     if (dlist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
 
-    // cualquiera entre head y tail
-    int i = 1;
-    while (actual && i < pos - 1) { // mover actual antes de pos
-        actual = actual->next;
-        i++;
-    }
+    Node *actual = dlist_node_at(list, pos); // nodo a liberar
 
-    before_actual = actual; // apuntamos al anterior
-    after_actual = actual->next->next; // apuntamos al siguiente
-    free(actual->next); // liberamos
-    before_actual->next = after_actual; // unimos las listas
-    after_actual->prev = before_actual; // unimos las listas
-    list->count--;
+    dlist_unlink(list, actual, pos);
+    dlist_node_release(list, actual); // liberamos
     return LIST_OK;
 }
 
-ListStatus dlist_clear(DList *list) {
+ListStatus dlist_pop_front(DList *list, int *value) {
     if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
     if (!list->head) return LIST_ERR_EMPTY;
 
-    Node *actual = list->head;
-    Node *next = NULL;
+    Node *actual = list->head; // nodo a liberar
 
-    while (actual) {
-        next = actual->next; // nodo siguiente
-        free(actual); // liberamos nodo actual
-        actual = next;
-    }
+    *value = actual->value;
+    dlist_unlink(list, actual, 1);
+    dlist_node_release(list, actual); // liberamos
+    return LIST_OK;
+}
 
-    list->head = NULL;
-    list->tail = NULL;
-    list->count = 0;
+ListStatus dlist_pop_back(DList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+    if (!list->tail) return LIST_ERR_EMPTY;
+
+    Node *actual = list->tail; // nodo a liberar, sin recorrer desde head
+
+    *value = actual->value;
+    dlist_unlink(list, actual, list->count);
+    dlist_node_release(list, actual); // liberamos
     return LIST_OK;
 }
 
-ListStatus dlist_sum(DList *list, int *sum) {
+ListStatus dlist_pop_front_n(DList *list, int *out, size_t n) {
     if (!list) return LIST_ERR_NULL;
     if (!list->head) return LIST_ERR_EMPTY;
+    if (n > (size_t)list->count) return LIST_ERR_OUT_OF_RANGE;
 
-    Node *actual = list -> head;
-    int total = 0;
+    for (size_t i = 0; i < n; i++) {
+        Node *actual = list->head; // nodo a liberar
 
-    while (actual) {
-        total += actual->value;
-        actual = actual->next;
+        if (out) out[i] = actual->value;
+        dlist_unlink(list, actual, 1);
+        dlist_node_release(list, actual); // liberamos
     }
 
-    *sum = total;
     return LIST_OK;
 }
 
-ListStatus dlist_destroy(DList *list) {
-    if (!list) return LIST_ERR_NULL;
-
-    slist_clear(list);
-    free(list);
-    return LIST_OK;
+/*
+ * Los nodos solo se pueden reenlazar de una lista a otra si ninguna usa pool:
+ * un nodo de pool pertenece a los slabs de su lista.
+ */
+static bool dlist_can_relink(const DList *dst, const DList *src) {
+    return !dst->pool && !src->pool;
 }
 
-void dlist_show(DList *list) {
-    Node *actual = list->head;
+/* Copia en nodos nuevos de dst los k valores de la cadena que empieza en first. */
+static Node *dlist_chain_copy(DList *dst, Node *first, int k, Node **last) {
+    Node *copy = NULL;
+    Node *prev = NULL;
 
-    printf("\n\nElementos de la lista: ");
-    printf("NULL <-> ");
-    while (actual) {
-        printf("%d <-> ", actual->value);
-        actual = actual->next;
-    }
+    for (int i = 0; i < k; i++, first = first->next) {
+        Node *new = dlist_node_alloc(dst); // nuevo nodo
 
-    printf("NULL");
+        if (!new) { // devolvemos lo que ya se reservó
+            while (copy) {
+                prev = copy->next;
+                dlist_node_release(dst, copy);
+                copy = prev;
+            }
+
+            return NULL;
+        }
+
+        new->value = first->value;
+        new->prev = prev;
+        new->next = NULL;
+
+        if (prev) prev->next = new;
+        else copy = new;
+        prev = new;
+    }
+
+    *last = prev;
+    return copy;
+}
+
+/* Desenlaza de src la cadena first..last de k nodos, que empieza en la posición from, sin liberarla. */
+static void dlist_detach(DList *src, Node *first, Node *last, int from, int k) {
+    Node *before_first = first->prev;
+    Node *after_last = last->next;
+
+    if (src->index) {
+        if (k <= DLIST_INDEX_WALK) { // pocos nodos: se quitan sus carriles uno a uno
+            for (int i = 0; i < k; i++) {
+                dlist_index_remove(src, from);
+            }
+        } else {
+            src->index->dirty = true; // se reconstruye en el próximo acceso
+        }
+    }
+
+    if (before_first) before_first->next = after_last;
+    else src->head = after_last; // era el primero
+
+    if (after_last) after_last->prev = before_first;
+    else src->tail = before_first; // era el último
+
+    first->prev = NULL;
+    last->next = NULL;
+    src->count -= k;
+
+    if (src->values) {
+        for (Node *actual = first; actual; actual = actual->next) {
+            dlist_values_remove(src, actual->value);
+        }
+    }
+
+    if (src->finger && src->finger_pos >= from + k) { // el dedo estaba después de la cadena
+        src->finger_pos -= k;
+    } else if (src->finger && src->finger_pos >= from) { // apuntaba a la cadena: pasa a un vecino
+        src->finger = after_last ? after_last : before_first;
+        src->finger_pos = after_last ? from : from - 1;
+    }
+}
+
+/* Enlaza la cadena first..last de k nodos de modo que first quede en la posición pos de dst. */
+static void dlist_attach(DList *dst, Node *first, Node *last, int k, int pos) {
+    Node *next = pos > dst->count ? NULL : dlist_node_at(dst, pos); // nodo que ocupa pos
+    Node *prev = next ? next->prev : dst->tail;
+
+    first->prev = prev;
+    last->next = next;
+
+    if (prev) prev->next = first;
+    else dst->head = first; // nuevo head
+
+    if (next) next->prev = last;
+    else dst->tail = last; // nuevo tail
+
+    if (dst->finger && dst->finger_pos >= pos) dst->finger_pos += k; // el dedo se recorre
+
+    if (dst->index && k <= DLIST_INDEX_WALK) { // pocos nodos: se agregan sus carriles uno a uno
+        int actual_pos = pos;
+
+        for (Node *actual = first; actual != next; actual = actual->next) {
+            dst->count++; // dlist_index_insert espera count ya incrementado
+            dlist_index_insert(dst, actual, actual_pos++);
+        }
+    } else {
+        dst->count += k;
+        if (dst->index) dst->index->dirty = true; // se reconstruye en el próximo acceso
+    }
+
+    if (dst->values) {
+        for (Node *actual = first; actual != next; actual = actual->next) {
+            dlist_values_add(dst, actual->value);
+        }
+    }
+}
+
+/*
+ * Mueve la cadena first..last de k nodos, que empieza en la posición from de
+ * src, a dst con first en la posición pos. Sin pool se reenlazan los nodos; con pool se copian los
+ * valores antes de tocar src, de modo que un fallo de malloc no cambia nada.
+ */
+static ListStatus dlist_move(DList *dst, int pos, DList *src, Node *first, Node *last, int from, int k) {
+    if (dlist_can_relink(dst, src)) {
+        dlist_detach(src, first, last, from, k);
+        dlist_attach(dst, first, last, k, pos);
+        return LIST_OK;
+    }
+
+    Node *copy_last = NULL;
+    Node *copy = dlist_chain_copy(dst, first, k, &copy_last);
+    if (!copy) return LIST_ERR_ALLOC;
+
+    dlist_detach(src, first, last, from, k);
+
+    while (first) { // liberamos los originales
+        Node *next = first->next;
+        dlist_node_release(src, first);
+        first = next;
+    }
+
+    dlist_attach(dst, copy, copy_last, k, pos);
+    return LIST_OK;
+}
+
+ListStatus dlist_concat(DList *dst, DList *src) {
+    if (!dst || !src) return LIST_ERR_NULL;
+    if (dst == src) return LIST_ERR_OUT_OF_RANGE;
+    if (!src->head) return LIST_OK; // nada que mover
+    if (src->count > INT_MAX - dst->count) return LIST_ERR_OUT_OF_RANGE;
+
+    return dlist_move(dst, dst->count + 1, src, src->head, src->tail, 1, src->count);
+}
+
+ListStatus dlist_splice(DList *dst, int pos, DList *src, int from, int to) {
+    if (!dst || !src) return LIST_ERR_NULL;
+    if (dst == src) return LIST_ERR_OUT_OF_RANGE;
+    if (!src->head) return LIST_ERR_EMPTY;
+    if (dlist_validate_position(dst, pos, 0) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+    if (from < 1 || to > src->count || from > to) return LIST_ERR_OUT_OF_RANGE;
+
+    int k = to - from + 1; // elementos a mover
+    if (k > INT_MAX - dst->count) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *first = dlist_node_at(src, from);
+    Node *last = dlist_node_at(src, to);
+
+    return dlist_move(dst, pos, src, first, last, from, k);
+}
+
+ListStatus dlist_split_at(DList *list, int pos, DList **out_tail) {
+    if (!list) return LIST_ERR_NULL;
+    if (!out_tail) return LIST_ERR_NULL;
+    if (dlist_validate_position(list, pos, 0) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    DList *tail = NULL; // misma configuración que list
+
+    if (list->pool) tail = dlist_create_pooled(list->pool->block_nodes);
+    else if (list->index) tail = dlist_create_indexed();
+    else tail = dlist_create();
+
+    if (!tail) return LIST_ERR_ALLOC;
+
+    if (list->values && dlist_enable_value_index(tail) != LIST_OK) {
+        dlist_destroy(tail);
+        return LIST_ERR_ALLOC;
+    }
+
+    if (pos <= list->count) {
+        ListStatus status = dlist_move(tail, 1, list, dlist_node_at(list, pos), list->tail, pos, list->count - pos + 1);
+
+        if (status != LIST_OK) {
+            dlist_destroy(tail);
+            return status;
+        }
+    }
+
+    *out_tail = tail;
+    return LIST_OK;
+}
+
+static bool dlist_equal_value(int value, void *ctx) {
+    return value == *(const int *)ctx;
+}
+
+/*
+ * Libera una cadena de nodos ya desenlazados. Si la lista quedó vacía y usa
+ * pool se liberan los slabs completos sin recorrer la cadena.
+ */
+static void dlist_chain_release(DList *list, Node *chain) {
+    if (list->pool && list->count == 0) {
+        node_pool_reset(list->pool);
+        return;
+    }
+
+    while (chain) {
+        Node *next = chain->next;
+        dlist_node_release(list, chain);
+        chain = next;
+    }
+}
+
+/*
+ * Desenlaza en un solo recorrido los nodos que cumplen pred, hasta limit
+ * nodos, y los libera al final. Devuelve cuántos se eliminaron.
+ */
+static size_t dlist_remove_matching(DList *list, ListPredicate pred, void *ctx, size_t limit) {
+    Node *actual = list->head;
+    Node *removed = NULL; // cadena de nodos desenlazados
+    size_t n = 0;
+
+    while (actual && n < limit) {
+        Node *next = actual->next;
+
+        if (pred(actual->value, ctx)) {
+            if (actual->prev) actual->prev->next = next;
+            else list->head = next; // era el primero
+
+            if (next) next->prev = actual->prev;
+            else list->tail = actual->prev; // era el último
+
+            dlist_values_remove(list, actual->value);
+            actual->next = removed;
+            removed = actual;
+            n++;
+        }
+
+        actual = next;
+    }
+
+    if (n) {
+        list->count -= (int)n;
+        list->finger = NULL; // las posiciones cambiaron
+        list->finger_pos = 0;
+        if (list->index) list->index->dirty = true; // se reconstruye en el próximo acceso
+    }
+
+    dlist_chain_release(list, removed);
+    return n;
+}
+
+ListStatus dlist_remove_if(DList *list, ListPredicate pred, void *ctx, size_t *removed) {
+    if (!list) return LIST_ERR_NULL;
+    if (!pred) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    size_t n = dlist_remove_matching(list, pred, ctx, SIZE_MAX);
+
+    if (removed) *removed = n;
+    return LIST_OK;
+}
+
+ListStatus dlist_remove_value(DList *list, int value, size_t *removed) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    size_t limit = list->values ? (size_t)value_index_count(list->values, value) : SIZE_MAX; // apariciones conocidas
+    size_t n = limit ? dlist_remove_matching(list, dlist_equal_value, &value, limit) : 0;
+
+    if (removed) *removed = n;
+    return LIST_OK;
+}
+
+ListStatus dlist_remove_range(DList *list, int from, int to) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (from < 1 || to > list->count || from > to) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *first = dlist_node_at(list, from);
+    Node *last = dlist_node_at(list, to);
+
+    dlist_detach(list, first, last, from, to - from + 1);
+    dlist_chain_release(list, first);
+    return LIST_OK;
+}
+
+ListStatus dlist_clear(DList *list) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    if (list->pool) { // liberamos los slabs completos
+        node_pool_reset(list->pool);
+        list->head = NULL;
+        list->tail = NULL;
+        list->count = 0;
+        if (list->values) value_index_clear(list->values);
+        list->finger = NULL;
+        list->finger_pos = 0;
+        if (list->index) dlist_index_drop(list);
+        return LIST_OK;
+    }
+
+    Node *actual = list->head;
+    Node *next = NULL;
+
+    while (actual) {
+        next = actual->next; // nodo siguiente
+        free(actual); // liberamos nodo actual
+        actual = next;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+    if (list->values) value_index_clear(list->values);
+    list->finger = NULL;
+    list->finger_pos = 0;
+    if (list->index) dlist_index_drop(list);
+    return LIST_OK;
+}
+
+/* Cadena con la menor cabeza; ante empate, la anterior. */
+static inline int dlist_merge_best(const int *keys, int live, ListCompare cmp) {
+    int best = 0;
+
+    for (int i = 1; i < live; i++) {
+        if (!run_sort_before(keys[best], keys[i], cmp)) best = i;
+    }
+
+    return best;
+}
+
+/* Quita la cadena i de las live en mezcla; las demás conservan su orden. */
+static inline void dlist_merge_drop(Node **heads, Node **lasts, int *keys, int i, int live) {
+    for (; i < live - 1; i++) {
+        heads[i] = heads[i + 1];
+        lasts[i] = lasts[i + 1];
+        keys[i] = keys[i + 1];
+    }
+}
+
+/*
+ * Mezcla estable de n cadenas ordenadas terminadas en NULL; chains[0] tiene
+ * los elementos más antiguos y gana los empates. La menor cabeza se elige con
+ * un recorrido lineal sobre keys, y al convertirse un nodo en cabeza se pide
+ * su siguiente con prefetch: mientras se consumen las otras cadenas ese
+ * nodo llega a la caché, así que hay hasta n fallos de caché en vuelo en lugar
+ * de uno. En tail se devuelve el último nodo de la mezcla.
+ */
+static Node *dlist_merge(Node **chains, Node **ends, int n, ListCompare cmp, Node **tail) {
+    Node *heads[DLIST_SORT_WAYS + 1];
+    Node *lasts[DLIST_SORT_WAYS + 1];
+    int keys[DLIST_SORT_WAYS + 1];
+    int live = 0; // cadenas con nodos
+
+    for (int i = 0; i < n; i++) {
+        if (!chains[i]) continue;
+
+        heads[live] = chains[i];
+        lasts[live] = ends[i];
+        keys[live] = chains[i]->value;
+        prefetch_read(chains[i]->next);
+        live++;
+    }
+
+    Node head; // nodo auxiliar para no tratar aparte el primero
+    Node *last = &head;
+
+    while (live > 1) { // cadenas que van completas antes que las demás se enlazan sin recorrerlas
+        int best = dlist_merge_best(keys, live, cmp);
+        int end_key = lasts[best]->value;
+        bool whole = true;
+
+        for (int i = 0; i < live && whole; i++) { // ante empate solo pasan las cadenas anteriores
+            if (i < best) whole = !run_sort_before(keys[i], end_key, cmp);
+            if (i > best) whole = run_sort_before(end_key, keys[i], cmp);
+        }
+
+        if (!whole) break;
+
+        last->next = heads[best];
+        heads[best]->prev = last;
+        last = lasts[best];
+        dlist_merge_drop(heads, lasts, keys, best, live--);
+    }
+
+    while (live > 1) {
+        int best = dlist_merge_best(keys, live, cmp);
+
+        Node *actual = heads[best];
+        last->next = actual;
+        actual->prev = last;
+        last = actual;
+
+        if (actual->next) { // avanza la cadena elegida
+            heads[best] = actual->next;
+            keys[best] = heads[best]->value;
+            prefetch_read(heads[best]->next);
+        } else { // la cadena se agotó
+            dlist_merge_drop(heads, lasts, keys, best, live--);
+        }
+    }
+
+    last->next = heads[0]; // lo que queda ya está ordenado
+    heads[0]->prev = last;
+    *tail = lasts[0];
+    head.next->prev = NULL; // el primero no tiene anterior
+    return head.next;
+}
+
+/*
+ * Merge sort bottom-up en dos fases. Primero cada tramo de RUN_SORT_BLOCK
+ * nodos consecutivos se ordena en un búfer de la pila y sus valores vuelven a
+ * los mismos nodos. Después los tramos se mezclan reenlazando nodos con un
+ * contador en base DLIST_SORT_WAYS: pending[l] guarda hasta DLIST_SORT_WAYS
+ * cadenas de DLIST_SORT_WAYS^l tramos y, al llenarse, se mezclan en una sola
+ * que sube al nivel siguiente. Mezclar varias cadenas a la vez reduce las
+ * pasadas sobre los nodos, que en una lista con los nodos dispersos en memoria
+ * son las que dominan el tiempo. La memoria extra es fija.
+ */
+ListStatus dlist_sort(DList *list, ListCompare cmp) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    Node *pending[DLIST_SORT_LEVELS][DLIST_SORT_WAYS + 1];
+    Node *ends[DLIST_SORT_LEVELS][DLIST_SORT_WAYS + 1]; // último nodo de cada cadena
+    int filled[DLIST_SORT_LEVELS] = {0};
+    int values[RUN_SORT_BLOCK];
+    int tmp[RUN_SORT_BLOCK];
+    Node *actual = list->head;
+    int used = 1; // niveles de pending en uso
+
+    while (actual) {
+        Node *run = actual; // primer nodo del tramo
+        Node *last = NULL;
+        size_t n = 0;
+
+        while (actual && n < RUN_SORT_BLOCK) { // copiamos el tramo
+            values[n++] = actual->value;
+            actual = actual->next;
+        }
+
+        run_sort(values, tmp, n, cmp);
+
+        Node *node = run;
+        for (size_t i = 0; i < n; i++) { // los valores vuelven ordenados a los mismos nodos
+            node->value = values[i];
+            last = node;
+            node = node->next;
+        }
+
+        last->next = NULL; // el tramo queda como cadena independiente
+        pending[0][filled[0]] = run;
+        ends[0][filled[0]++] = last;
+
+        for (int l = 0; filled[l] == DLIST_SORT_WAYS; l++) { // acarreo al nivel siguiente
+            Node *merged_end = NULL;
+            Node *merged = dlist_merge(pending[l], ends[l], DLIST_SORT_WAYS, cmp, &merged_end);
+
+            filled[l] = 0;
+            pending[l + 1][filled[l + 1]] = merged;
+            ends[l + 1][filled[l + 1]++] = merged_end;
+            if (l + 2 > used) used = l + 2;
+        }
+    }
+
+    Node *sorted = NULL;
+    Node *sorted_end = NULL;
+
+    for (int l = 0; l < used; l++) { // el nivel l tiene elementos anteriores a sorted
+        if (!filled[l]) continue;
+
+        pending[l][filled[l]] = sorted;
+        ends[l][filled[l]] = sorted_end;
+        sorted = dlist_merge(pending[l], ends[l], filled[l] + 1, cmp, &sorted_end);
+    }
+
+    list->head = sorted;
+    list->tail = sorted_end;
+    list->finger = NULL; // las posiciones cambiaron
+    list->finger_pos = 0;
+    if (list->index) list->index->dirty = true; // se reconstruye en el próximo acceso
+    return LIST_OK;
+}
+
+typedef struct RadixItem {
+    Node *node;
+    unsigned key; // valor con el bit de signo invertido: ordena como unsigned
+} RadixItem;
+
+typedef struct RadixShared {
+    RadixItem *src; // arreglo que se lee en la pasada
+    RadixItem *dst; // arreglo que se escribe en la pasada
+    size_t n;
+    unsigned threads;
+    int shift; // desplazamiento del dígito de la pasada
+    size_t (*counts)[DLIST_RADIX_BUCKETS]; // histograma de cada hilo; tras el prefijo, su destino
+} RadixShared;
+
+typedef struct RadixTask {
+    RadixShared *shared;
+    unsigned id; // el hilo id procesa el tramo [id * n / threads, (id + 1) * n / threads)
+    void (*run)(struct RadixTask *task);
+} RadixTask;
+
+static void dlist_radix_range(RadixTask *task, size_t *begin, size_t *end) {
+    RadixShared *shared = task->shared;
+
+    *begin = shared->n * task->id / shared->threads;
+    *end = shared->n * (task->id + 1) / shared->threads;
+}
+
+static void dlist_radix_histogram(RadixTask *task) {
+    RadixShared *shared = task->shared;
+    size_t *counts = shared->counts[task->id];
+    size_t begin, end;
+
+    dlist_radix_range(task, &begin, &end);
+
+    for (int b = 0; b < DLIST_RADIX_BUCKETS; b++) {
+        counts[b] = 0;
+    }
+
+    for (size_t i = begin; i < end; i++) {
+        counts[(shared->src[i].key >> shared->shift) & (DLIST_RADIX_BUCKETS - 1)]++;
+    }
+}
+
+static void dlist_radix_scatter(RadixTask *task) {
+    RadixShared *shared = task->shared;
+    size_t *offsets = shared->counts[task->id];
+    size_t begin, end;
+
+    dlist_radix_range(task, &begin, &end);
+
+    for (size_t i = begin; i < end; i++) { // en orden: cada hilo escribe en su hueco y se conserva la estabilidad
+        RadixItem item = shared->src[i];
+        shared->dst[offsets[(item.key >> shared->shift) & (DLIST_RADIX_BUCKETS - 1)]++] = item;
+    }
+}
+
+static void *dlist_radix_thread(void *arg) {
+    RadixTask *task = arg;
+
+    task->run(task);
+    return NULL;
+}
+
+/*
+ * Ejecuta run sobre todos los tramos: el hilo que llama hace el tramo 0 y
+ * lanza un hilo para cada uno de los demás. Si no se puede crear un hilo, su
+ * tramo se hace aquí mismo.
+ */
+static void dlist_radix_parallel(RadixShared *shared, RadixTask *tasks, void (*run)(RadixTask *task)) {
+    pthread_t handles[DLIST_RADIX_MAX_THREADS];
+    bool started[DLIST_RADIX_MAX_THREADS];
+
+    for (unsigned t = 0; t < shared->threads; t++) {
+        tasks[t].shared = shared;
+        tasks[t].id = t;
+        tasks[t].run = run;
+        started[t] = t > 0 && pthread_create(&handles[t], NULL, dlist_radix_thread, &tasks[t]) == 0;
+    }
+
+    for (unsigned t = 0; t < shared->threads; t++) {
+        if (!started[t]) run(&tasks[t]);
+    }
+
+    for (unsigned t = 1; t < shared->threads; t++) {
+        if (started[t]) pthread_join(handles[t], NULL);
+    }
+}
+
+ListStatus dlist_sort_radix(DList *list, unsigned threads) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    size_t n = (size_t)list->count;
+
+    if (threads == 0) { // un hilo por procesador
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? (unsigned)online : 1;
+    }
+
+    if (threads > n / DLIST_RADIX_MIN_CHUNK) threads = (unsigned)(n / DLIST_RADIX_MIN_CHUNK); // tramos muy cortos no compensan
+    if (threads > DLIST_RADIX_MAX_THREADS) threads = DLIST_RADIX_MAX_THREADS;
+    if (threads == 0) threads = 1;
+
+    RadixItem *items = malloc(2 * n * sizeof(RadixItem)); // arreglo y su espejo para las pasadas
+    size_t (*counts)[DLIST_RADIX_BUCKETS] = malloc(threads * sizeof(*counts));
+
+    if (!items || !counts) {
+        free(items);
+        free(counts);
+        return LIST_ERR_ALLOC;
+    }
+
+    size_t i = 0;
+    for (Node *actual = list->head; actual; actual = actual->next, i++) { // recolectamos nodos y claves
+        items[i].node = actual;
+        items[i].key = (unsigned)actual->value ^ 0x80000000u;
+    }
+
+    RadixShared shared = {items, items + n, n, threads, 0, counts};
+    RadixTask tasks[DLIST_RADIX_MAX_THREADS];
+
+    for (int shift = 0; shift < (int)(sizeof(unsigned) * CHAR_BIT); shift += DLIST_RADIX_BITS) {
+        shared.shift = shift;
+        dlist_radix_parallel(&shared, tasks, dlist_radix_histogram);
+
+        // prefijo: cada cubeta empieza tras las menores, y dentro de ella van los hilos en orden
+        size_t offset = 0;
+        bool single = false; // todas las claves comparten el dígito: la pasada no mueve nada
+
+        for (int b = 0; b < DLIST_RADIX_BUCKETS; b++) {
+            size_t start = offset;
+
+            for (unsigned t = 0; t < threads; t++) {
+                size_t count = counts[t][b];
+
+                counts[t][b] = offset;
+                offset += count;
+            }
+
+            if (offset - start == n) single = true; // se suman los hilos: cada uno solo vio su tramo
+        }
+
+        if (single) continue;
+
+        dlist_radix_parallel(&shared, tasks, dlist_radix_scatter);
+
+        RadixItem *swap = shared.src; // el resultado es la entrada de la siguiente pasada
+        shared.src = shared.dst;
+        shared.dst = swap;
+    }
+
+    Node *prev = NULL;
+    for (i = 0; i < n; i++) { // reenlazamos en el orden del arreglo
+        Node *actual = shared.src[i].node;
+
+        if (i + PREFETCH_DISTANCE < n) prefetch_read(shared.src[i + PREFETCH_DISTANCE].node);
+
+        actual->prev = prev;
+        if (prev) prev->next = actual;
+        else list->head = actual;
+        prev = actual;
+    }
+
+    prev->next = NULL;
+    list->tail = prev;
+    list->finger = NULL; // las posiciones cambiaron
+    list->finger_pos = 0;
+    if (list->index) list->index->dirty = true; // se reconstruye en el próximo acceso
+
+    free(items);
+    free(counts);
+    return LIST_OK;
+}
+
+ListStatus dlist_sum(DList *list, int *sum) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    Node *actual = list -> head;
+    int total = 0;
+
+    while (actual) {
+        total += actual->value;
+        actual = actual->next;
+    }
+
+    *sum = total;
+    return LIST_OK;
+}
+
+typedef struct ParSegment {
+    Node *first;
+    int count;
+} ParSegment;
+
+typedef struct DListPar {
+    ParSegment *segments;
+    unsigned *sums; // suma de cada tramo, sin signo para desbordarse igual que dlist_sum
+    ParSegment single; // tramo único cuando no conviene repartir
+    unsigned single_sum;
+    int value; // valor que busca dlist_par_contains
+    int found; // algún hilo ya lo encontró
+    ListVisit fn; // función de dlist_par_for_each
+    void *ctx;
+} DListPar;
+
+/*
+ * Parte la lista en tramos consecutivos de al menos size nodos (el último
+ * puede ser más corto) y devuelve cuántos quedaron, como mucho max. Si la
+ * lista es indexada los cortes salen del nivel de carriles cuya separación
+ * se acerca más a size, sin recorrer los nodos; si no, se recorre la lista
+ * una vez.
+ */
+static size_t dlist_par_split(DList *list, int size, ParSegment *segments, size_t max) {
+    size_t k = 1;
+    int start = 1; // posición del primer nodo del tramo actual
+
+    segments[0].first = list->head;
+
+    if (list->index) {
+        DListIndex *index = list->index;
+        int level = 0;
+        long spacing = 4; // separación esperada de los carriles del nivel
+
+        if (index->dirty) dlist_index_rebuild(list);
+
+        while (level + 1 < index->levels && spacing * 4 <= size) {
+            level++;
+            spacing *= 4;
+        }
+
+        Lane *lane = index->header;
+        int rank = 0;
+
+        while (lane->links[level].next && k < max) {
+            rank += lane->links[level].width;
+            lane = lane->links[level].next;
+
+            if (rank - start >= size) { // el carril abre un tramo nuevo
+                segments[k - 1].count = rank - start;
+                segments[k++].first = lane->node;
+                start = rank;
+            }
+        }
+    } else {
+        Node *actual = list->head;
+
+        for (int pos = 1; actual && k < max; pos++, actual = actual->next) {
+            if (pos - start == size) {
+                segments[k - 1].count = size;
+                segments[k++].first = actual;
+                start = pos;
+            }
+        }
+    }
+
+    segments[k - 1].count = list->count - start + 1;
+    return k;
+}
+
+/*
+ * Reparte run entre threads hilos sobre tramos de la lista y devuelve
+ * cuántos tramos hubo. Una lista corta, un solo hilo o un fallo de malloc
+ * se resuelven con un solo tramo en el hilo que llama, así que nunca falla.
+ * par->sums queda con la suma de cada tramo si run la calcula; se libera
+ * con dlist_par_free.
+ */
+static size_t dlist_par_run(DList *list, unsigned threads, ParTask run, DListPar *par) {
+    size_t chunks = (size_t)list->count / DLIST_PAR_MIN_CHUNK;
+    size_t wanted;
+    size_t segments = 1;
+
+    threads = par_pool_threads(threads, chunks);
+    wanted = (size_t)threads * DLIST_PAR_SPLIT;
+    if (wanted > chunks) wanted = chunks;
+
+    par->segments = &par->single;
+    par->sums = &par->single_sum;
+    par->found = 0;
+
+    if (threads > 1 && wanted > 1) {
+        ParSegment *split = malloc(wanted * sizeof(ParSegment));
+        unsigned *sums = malloc(wanted * sizeof(unsigned));
+
+        if (split && sums) {
+            par->segments = split;
+            par->sums = sums;
+            segments = dlist_par_split(list, (int)((size_t)list->count / wanted), split, wanted);
+        } else {
+            free(split);
+            free(sums);
+        }
+    }
+
+    if (segments == 1) {
+        par->single.first = list->head;
+        par->single.count = list->count;
+        run(par, 0);
+    } else {
+        par_pool_run(threads < segments ? threads : (unsigned)segments, segments, run, par);
+    }
+
+    return segments;
+}
+
+static void dlist_par_free(DListPar *par) {
+    if (par->segments != &par->single) free(par->segments);
+    if (par->sums != &par->single_sum) free(par->sums);
+}
+
+static void dlist_par_sum_task(void *ctx, size_t task) {
+    DListPar *par = ctx;
+    Node *actual = par->segments[task].first;
+    unsigned total = 0;
+
+    for (int i = par->segments[task].count; i > 0; i--) {
+        total += (unsigned)actual->value;
+        actual = actual->next;
+    }
+
+    par->sums[task] = total;
+}
+
+static void dlist_par_contains_task(void *ctx, size_t task) {
+    DListPar *par = ctx;
+    Node *actual = par->segments[task].first;
+
+    for (int i = par->segments[task].count; i > 0; i--) {
+        if ((i % DLIST_PAR_CHECK) == 0 && __atomic_load_n(&par->found, __ATOMIC_RELAXED)) return; // ya se encontró
+
+        if (actual->value == par->value) { // se encuentra
+            __atomic_store_n(&par->found, 1, __ATOMIC_RELAXED);
+            return;
+        }
+
+        actual = actual->next;
+    }
+}
+
+static void dlist_par_for_each_task(void *ctx, size_t task) {
+    DListPar *par = ctx;
+    Node *actual = par->segments[task].first;
+
+    for (int i = par->segments[task].count; i > 0; i--) {
+        par->fn(actual->value, par->ctx);
+        actual = actual->next;
+    }
+}
+
+ListStatus dlist_par_sum(DList *list, unsigned threads, int *sum) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    DListPar par;
+    size_t segments = dlist_par_run(list, threads, dlist_par_sum_task, &par);
+    unsigned total = 0;
+
+    for (size_t i = 0; i < segments; i++) {
+        total += par.sums[i];
+    }
+
+    dlist_par_free(&par);
+    *sum = (int)total;
+    return LIST_OK;
+}
+
+ListStatus dlist_par_contains(DList *list, unsigned threads, int value, bool *found) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    if (list->values) { // respuesta directa del índice
+        *found = value_index_count(list->values, value) > 0;
+        return LIST_OK;
+    }
+
+    DListPar par;
+
+    par.value = value;
+    dlist_par_run(list, threads, dlist_par_contains_task, &par);
+    dlist_par_free(&par);
+    *found = par.found;
+    return LIST_OK;
+}
+
+ListStatus dlist_par_for_each(DList *list, unsigned threads, ListVisit fn, void *ctx) {
+    if (!list) return LIST_ERR_NULL;
+    if (!fn) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    DListPar par;
+
+    par.fn = fn;
+    par.ctx = ctx;
+    dlist_par_run(list, threads, dlist_par_for_each_task, &par);
+    dlist_par_free(&par);
+    return LIST_OK;
+}
+
+/*
+ * Copia la lista en out desde head (reverse == false) o desde tail
+ * siguiendo prev, con un puntero adelantado que hace prefetch.
+ */
+static ListStatus dlist_copy_out(DList *list, int *out, size_t cap, size_t *written, bool reverse) {
+    if (!list) return LIST_ERR_NULL;
+    if (!written) return LIST_ERR_NULL;
+
+    *written = 0;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (!out && cap) return LIST_ERR_NULL;
+
+    Node *actual = reverse ? list->tail : list->head;
+    Node *ahead = actual; // va PREFETCH_DISTANCE nodos por delante
+    size_t i = 0;
+
+    for (int d = 0; d < PREFETCH_DISTANCE && ahead; d++) {
+        ahead = reverse ? ahead->prev : ahead->next;
+    }
+
+    while (actual && i < cap) {
+        if (ahead) { // pedimos el nodo lejano antes de necesitarlo
+            ahead = reverse ? ahead->prev : ahead->next;
+            prefetch_read(ahead);
+        }
+
+        out[i++] = actual->value;
+        actual = reverse ? actual->prev : actual->next;
+    }
+
+    *written = i;
+    return actual ? LIST_ERR_OUT_OF_RANGE : LIST_OK;
+}
+
+ListStatus dlist_to_array(DList *list, int *out, size_t cap, size_t *written) {
+    return dlist_copy_out(list, out, cap, written, false);
+}
+
+ListStatus dlist_to_array_reverse(DList *list, int *out, size_t cap, size_t *written) {
+    return dlist_copy_out(list, out, cap, written, true);
+}
+
+ListStatus dlist_save(DList *list, int fd) {
+    if (!list) return LIST_ERR_NULL;
+
+    SnapshotWriter writer;
+    ListStatus status = snapshot_write_begin(&writer, fd, (uint64_t)list->count);
+    if (status != LIST_OK) return status;
+
+    Node *actual = list->head;
+    Node *ahead = list->head; // va PREFETCH_DISTANCE nodos por delante
+
+    for (int d = 0; d < PREFETCH_DISTANCE && ahead; d++) {
+        ahead = ahead->next;
+    }
+
+    while (actual && status == LIST_OK) {
+        size_t n = 0;
+
+        while (actual && n < SNAPSHOT_CHUNK) {
+            if (ahead) { // pedimos el nodo lejano antes de necesitarlo
+                ahead = ahead->next;
+                prefetch_read(ahead);
+            }
+
+            writer.values[n++] = actual->value;
+            actual = actual->next;
+        }
+
+        status = snapshot_write_chunk(&writer, n);
+    }
+
+    return snapshot_write_end(&writer, status);
+}
+
+ListStatus dlist_load(int fd, DList **out) {
+    if (!out) return LIST_ERR_NULL;
+
+    SnapshotReader reader;
+    uint64_t count = 0;
+    ListStatus status = snapshot_read_begin(&reader, fd, &count);
+    if (status != LIST_OK) return snapshot_read_end(&reader, status);
+    if (count > INT_MAX) return snapshot_read_end(&reader, LIST_ERR_FORMAT);
+
+    /* Con pool cada chunk es un solo bloque de nodos contiguos: un malloc por chunk. */
+    DList *list = dlist_create_pooled(count < SNAPSHOT_CHUNK ? (size_t)count : SNAPSHOT_CHUNK);
+    if (!list) return snapshot_read_end(&reader, LIST_ERR_ALLOC);
+
+    while (status == LIST_OK && (uint64_t)list->count < count) {
+        size_t n = 0;
+
+        status = snapshot_read_chunk(&reader, &n);
+        if (status == LIST_OK) status = dlist_extend(list, reader.values, n);
+    }
+
+    status = snapshot_read_end(&reader, status);
+    if (status != LIST_OK) {
+        dlist_destroy(list);
+        return status;
+    }
+
+    *out = list;
+    return LIST_OK;
+}
+
+ListStatus dlist_aggregate(DList *list, unsigned flags, int value, ListAggregate *result) {
+    if (!list) return LIST_ERR_NULL;
+    if (!result) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    int buffer[AGGREGATE_BLOCK]; // valores reunidos durante el recorrido
+    size_t filled = 0;
+    Node *actual = list->head;
+
+    aggregate_init(result);
+
+    while (actual) {
+        buffer[filled++] = actual->value;
+        actual = actual->next;
+
+        if (filled == AGGREGATE_BLOCK) { // reducimos el búfer lleno
+            aggregate_block(buffer, filled, flags, value, result);
+            filled = 0;
+        }
+    }
+
+    aggregate_block(buffer, filled, flags, value, result); // resto del búfer
+    return LIST_OK;
+}
+
+ListStatus dlist_sum64(DList *list, long long *sum) {
+    ListAggregate result;
+    ListStatus status = dlist_aggregate(list, LIST_AGG_SUM, 0, &result);
+
+    if (status != LIST_OK) return status;
+
+    *sum = result.sum;
+    return LIST_OK;
+}
+
+ListStatus dlist_min(DList *list, int *min) {
+    ListAggregate result;
+    ListStatus status = dlist_aggregate(list, LIST_AGG_MIN, 0, &result);
+
+    if (status != LIST_OK) return status;
+
+    *min = result.min;
+    return LIST_OK;
+}
+
+ListStatus dlist_max(DList *list, int *max) {
+    ListAggregate result;
+    ListStatus status = dlist_aggregate(list, LIST_AGG_MAX, 0, &result);
+
+    if (status != LIST_OK) return status;
+
+    *max = result.max;
+    return LIST_OK;
+}
+
+ListStatus dlist_minmax(DList *list, int *min, int *max) {
+    ListAggregate result;
+    ListStatus status = dlist_aggregate(list, LIST_AGG_MIN | LIST_AGG_MAX, 0, &result);
+
+    if (status != LIST_OK) return status;
+
+    *min = result.min;
+    *max = result.max;
+    return LIST_OK;
+}
+
+ListStatus dlist_count_if_equal(DList *list, int value, int *count) {
+    if (list && list->head && list->values) { // respuesta directa del índice
+        *count = value_index_count(list->values, value);
+        return LIST_OK;
+    }
+
+    ListAggregate result;
+    ListStatus status = dlist_aggregate(list, LIST_AGG_COUNT_EQUAL, value, &result);
+
+    if (status != LIST_OK) return status;
+
+    *count = result.equal_count;
+    return LIST_OK;
+}
+
+ListStatus dlist_destroy(DList *list) {
+    if (!list) return LIST_ERR_NULL;
+
+    dlist_clear(list);
+    value_index_destroy(list->values);
+    dlist_index_destroy(list);
+    node_pool_destroy(list->pool);
+    free(list);
+    return LIST_OK;
+}
+
+void dlist_show(DList *list) {
+    Node *actual = list->head;
+
+    printf("\n\nElementos de la lista: ");
+    printf("NULL <-> ");
+    while (actual) {
+        printf("%d <-> ", actual->value);
+        actual = actual->next;
+    }
+
+    printf("NULL");
 
     actual = list->tail;
 
@@ -344,4 +1923,85 @@ void dlist_show(DList *list) {
     }
 
     printf("NULL");
-}
\ No newline at end of file
+}
+ListStatus dlist_cursor_begin(DList *list, DListCursor *cursor) {
+    if (!list) return LIST_ERR_NULL;
+    if (!cursor) return LIST_ERR_NULL;
+
+    cursor->list = list;
+    cursor->node = list->head;
+    cursor->pos = 1;
+    return LIST_OK;
+}
+
+ListStatus dlist_cursor_next(DListCursor *cursor) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    cursor->node = ((Node *)cursor->node)->next;
+    cursor->pos++;
+    return LIST_OK;
+}
+
+ListStatus dlist_cursor_prev(DListCursor *cursor) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+
+    Node *prev = cursor->node ? ((Node *)cursor->node)->prev : cursor->list->tail;
+    if (!prev) return LIST_ERR_OUT_OF_RANGE; // ya estaba en el primero
+
+    cursor->node = prev;
+    cursor->pos--;
+    return LIST_OK;
+}
+
+ListStatus dlist_cursor_get(DListCursor *cursor, int *value) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    *value = ((Node *)cursor->node)->value;
+    return LIST_OK;
+}
+
+ListStatus dlist_cursor_set(DListCursor *cursor, int value) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    dlist_node_set(cursor->list, cursor->node, value);
+    return LIST_OK;
+}
+
+ListStatus dlist_cursor_insert_before(DListCursor *cursor, int value) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+
+    Node *new = dlist_node_alloc(cursor->list); // nuevo nodo
+    if (!new) return LIST_ERR_ALLOC;
+
+    new->value = value;
+    dlist_link(cursor->list, new, cursor->node, cursor->pos);
+    cursor->pos++; // el cursor sigue en el mismo nodo
+    return LIST_OK;
+}
+
+ListStatus dlist_cursor_insert_after(DListCursor *cursor, int value) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *new = dlist_node_alloc(cursor->list); // nuevo nodo
+    if (!new) return LIST_ERR_ALLOC;
+
+    new->value = value;
+    dlist_link(cursor->list, new, ((Node *)cursor->node)->next, cursor->pos + 1);
+    return LIST_OK;
+}
+
+ListStatus dlist_cursor_erase(DListCursor *cursor) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *actual = cursor->node;
+
+    cursor->node = actual->next; // el cursor pasa al siguiente, en la misma posición
+    dlist_unlink(cursor->list, actual, cursor->pos);
+    dlist_node_release(cursor->list, actual); // liberamos
+    return LIST_OK;
+}
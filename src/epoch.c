@@ -0,0 +1,288 @@
+#include "epoch.h"
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define EPOCH_LINE 64 // bytes por línea de caché
+#define EPOCH_BATCH 128 // nodos pendientes entre intentos de avanzar la época
+
+typedef struct EpochRetired {
+    void *ptr;
+    void (*release)(void *);
+    unsigned long epoch; // época global al retirarlo
+} EpochRetired;
+
+/*
+ * Registro de un hilo. state solo lo escribe su dueño y lo leen los hilos
+ * que intentan avanzar la época; el resto de campos es privado del dueño.
+ * Cada registro ocupa su propia línea para que entrar en una sección no
+ * invalide la caché de otros hilos.
+ */
+typedef struct EpochSlot {
+    unsigned long state; // época << 1 | 1 dentro de una sección, 0 fuera
+    int in_use; // 1 mientras un hilo lo ocupa
+    int depth; // secciones anidadas abiertas
+    EpochRetired *retired; // nodos pendientes de liberar
+    size_t retired_count;
+    size_t retired_capacity;
+    size_t collect_at; // retired_count con el que se intenta liberar otra vez
+} __attribute__((aligned(EPOCH_LINE))) EpochSlot;
+
+/*
+ * Estado global del proceso, compartido por todas las estructuras
+ * concurrentes: la época, los registros de los hilos y los nodos huérfanos
+ * que dejaron hilos que ya terminaron.
+ */
+static unsigned long epoch_global;
+static int epoch_high; // registros que se han ocupado alguna vez
+static EpochSlot epoch_slots[EPOCH_MAX_THREADS];
+
+static pthread_mutex_t epoch_orphans_lock = PTHREAD_MUTEX_INITIALIZER;
+static EpochRetired *epoch_orphans; // pendientes de hilos que terminaron
+static size_t epoch_orphan_count;
+static size_t epoch_orphan_capacity;
+
+static __thread EpochSlot *epoch_self; // registro del hilo actual
+static pthread_key_t epoch_key; // libera el registro cuando el hilo termina
+static pthread_once_t epoch_once = PTHREAD_ONCE_INIT;
+
+/*
+ * Pasa los pendientes del registro a la lista de huérfanos, que cualquier
+ * hilo libera más tarde. Si no hay memoria para ampliarla se quedan en el
+ * registro y los libera su siguiente dueño.
+ */
+static void epoch_orphan(EpochSlot *slot) {
+    if (!slot->retired_count) return;
+
+    pthread_mutex_lock(&epoch_orphans_lock);
+
+    size_t needed = epoch_orphan_count + slot->retired_count;
+
+    if (needed > epoch_orphan_capacity) {
+        size_t capacity = epoch_orphan_capacity ? epoch_orphan_capacity : EPOCH_BATCH;
+        while (capacity < needed) capacity *= 2;
+
+        EpochRetired *grown = realloc(epoch_orphans, capacity * sizeof(EpochRetired));
+
+        if (!grown) {
+            pthread_mutex_unlock(&epoch_orphans_lock);
+            return;
+        }
+
+        epoch_orphans = grown;
+        epoch_orphan_capacity = capacity;
+    }
+
+    for (size_t i = 0; i < slot->retired_count; i++) {
+        epoch_orphans[epoch_orphan_count + i] = slot->retired[i];
+    }
+
+    __atomic_store_n(&epoch_orphan_count, needed, __ATOMIC_RELAXED); // se consulta sin candado
+    pthread_mutex_unlock(&epoch_orphans_lock);
+
+    free(slot->retired);
+    slot->retired = NULL;
+    slot->retired_count = 0;
+    slot->retired_capacity = 0;
+    slot->collect_at = 0;
+}
+
+static void epoch_thread_exit(void *arg) {
+    EpochSlot *slot = arg;
+
+    slot->depth = 0;
+    __atomic_store_n(&slot->state, 0, __ATOMIC_RELEASE);
+    epoch_orphan(slot);
+    __atomic_store_n(&slot->in_use, 0, __ATOMIC_RELEASE);
+}
+
+static void epoch_init(void) {
+    pthread_key_create(&epoch_key, epoch_thread_exit);
+}
+
+/* Devuelve el registro del hilo, ocupando uno libre la primera vez; NULL si no hay. */
+static EpochSlot *epoch_slot(void) {
+    if (epoch_self) return epoch_self;
+
+    pthread_once(&epoch_once, epoch_init);
+
+    for (int i = 0; i < EPOCH_MAX_THREADS; i++) {
+        EpochSlot *slot = &epoch_slots[i];
+        int expected = 0;
+
+        if (__atomic_load_n(&slot->in_use, __ATOMIC_RELAXED)) continue;
+        if (!__atomic_compare_exchange_n(&slot->in_use, &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            continue;
+        }
+
+        int high = __atomic_load_n(&epoch_high, __ATOMIC_RELAXED);
+        while (high < i + 1 && !__atomic_compare_exchange_n(&epoch_high, &high, i + 1, true,
+                                                            __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {}
+
+        slot->depth = 0;
+        pthread_setspecific(epoch_key, slot);
+        epoch_self = slot;
+        return slot;
+    }
+
+    return NULL;
+}
+
+/*
+ * Avanza la época global si todos los hilos dentro de una sección ya la
+ * observaron. Devuelve la época global resultante.
+ */
+static unsigned long epoch_try_advance(void) {
+    unsigned long epoch = __atomic_load_n(&epoch_global, __ATOMIC_RELAXED);
+    int high = __atomic_load_n(&epoch_high, __ATOMIC_ACQUIRE);
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    for (int i = 0; i < high; i++) {
+        unsigned long state = __atomic_load_n(&epoch_slots[i].state, __ATOMIC_ACQUIRE);
+
+        if ((state & 1) && (state >> 1) != epoch) return epoch; // un hilo sigue en una época anterior
+    }
+
+    if (__atomic_compare_exchange_n(&epoch_global, &epoch, epoch + 1, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+        return epoch + 1;
+    }
+
+    return epoch; // otro hilo la avanzó primero
+}
+
+/* Libera los huérfanos retirados hace al menos dos épocas, si nadie más lo está haciendo. */
+static void epoch_collect_orphans(unsigned long epoch) {
+    if (!__atomic_load_n(&epoch_orphan_count, __ATOMIC_RELAXED)) return;
+    if (pthread_mutex_trylock(&epoch_orphans_lock) != 0) return;
+
+    size_t kept = 0;
+
+    for (size_t i = 0; i < epoch_orphan_count; i++) {
+        EpochRetired *retired = &epoch_orphans[i];
+
+        if (retired->epoch + 2 <= epoch) retired->release(retired->ptr);
+        else epoch_orphans[kept++] = *retired;
+    }
+
+    __atomic_store_n(&epoch_orphan_count, kept, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&epoch_orphans_lock);
+}
+
+/* Libera los nodos del registro (y los huérfanos) retirados hace al menos dos épocas. */
+static void epoch_collect(EpochSlot *slot) {
+    unsigned long epoch = __atomic_load_n(&epoch_global, __ATOMIC_ACQUIRE);
+    size_t kept = 0;
+
+    epoch_collect_orphans(epoch);
+
+    for (size_t i = 0; i < slot->retired_count; i++) {
+        EpochRetired *retired = &slot->retired[i];
+
+        if (retired->epoch + 2 <= epoch) retired->release(retired->ptr);
+        else slot->retired[kept++] = *retired;
+    }
+
+    slot->retired_count = kept;
+    slot->collect_at = kept + EPOCH_BATCH;
+}
+
+ListStatus epoch_enter(void) {
+    EpochSlot *slot = epoch_slot();
+
+    if (!slot) return LIST_ERR_ALLOC;
+    if (slot->depth++ > 0) return LIST_OK; // sección anidada
+
+    unsigned long epoch = __atomic_load_n(&epoch_global, __ATOMIC_RELAXED);
+
+    for (;;) { // publicamos la época y confirmamos que no cambió mientras tanto
+        __atomic_exchange_n(&slot->state, epoch << 1 | 1, __ATOMIC_SEQ_CST); // en x86 xchg es más barato que mfence
+
+        unsigned long now = __atomic_load_n(&epoch_global, __ATOMIC_SEQ_CST);
+        if (now == epoch) return LIST_OK;
+        epoch = now;
+    }
+}
+
+void epoch_exit(void) {
+    EpochSlot *slot = epoch_self;
+
+    if (--slot->depth == 0) __atomic_store_n(&slot->state, 0, __ATOMIC_RELEASE);
+}
+
+void epoch_retire(void *ptr, void (*release)(void *)) {
+    EpochSlot *slot = epoch_slot();
+
+    if (slot && slot->retired_count == slot->retired_capacity) {
+        size_t capacity = slot->retired_capacity ? slot->retired_capacity * 2 : EPOCH_BATCH;
+        EpochRetired *grown = realloc(slot->retired, capacity * sizeof(EpochRetired));
+
+        if (grown) {
+            slot->retired = grown;
+            slot->retired_capacity = capacity;
+        }
+    }
+
+    if (!slot || slot->retired_count == slot->retired_capacity) { // sin lugar: esperamos la época completa
+        epoch_synchronize();
+        release(ptr);
+        return;
+    }
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST); // el desenlace queda antes de leer la época
+
+    EpochRetired *retired = &slot->retired[slot->retired_count++];
+    retired->ptr = ptr;
+    retired->release = release;
+    retired->epoch = __atomic_load_n(&epoch_global, __ATOMIC_RELAXED);
+
+    if (slot->retired_count >= slot->collect_at) {
+        epoch_try_advance();
+        epoch_collect(slot);
+    }
+}
+
+void epoch_synchronize(void) {
+    unsigned long target = __atomic_load_n(&epoch_global, __ATOMIC_ACQUIRE) + 2;
+
+    while (epoch_try_advance() < target) { // esperamos a los hilos que siguen dentro
+        sched_yield();
+    }
+
+    if (epoch_self) epoch_collect(epoch_self);
+    else epoch_collect_orphans(__atomic_load_n(&epoch_global, __ATOMIC_ACQUIRE));
+}
+
+/*
+ * Al terminar el proceso libera todo lo pendiente: el registro del hilo
+ * principal (su destructor de pthread_key no se ejecuta al volver de main),
+ * los de hilos que siguen vivos y los huérfanos. Si algún hilo sigue dentro
+ * de una sección no se libera nada, porque podría estar leyendo esos nodos.
+ */
+__attribute__((destructor)) static void epoch_teardown(void) {
+    int high = __atomic_load_n(&epoch_high, __ATOMIC_ACQUIRE);
+
+    for (int i = 0; i < high; i++) {
+        if (__atomic_load_n(&epoch_slots[i].state, __ATOMIC_ACQUIRE) & 1) return;
+    }
+
+    for (int i = 0; i < high; i++) {
+        EpochSlot *slot = &epoch_slots[i];
+
+        for (size_t j = 0; j < slot->retired_count; j++) slot->retired[j].release(slot->retired[j].ptr);
+        free(slot->retired);
+        slot->retired = NULL;
+        slot->retired_count = 0;
+        slot->retired_capacity = 0;
+    }
+
+    pthread_mutex_lock(&epoch_orphans_lock);
+    for (size_t i = 0; i < epoch_orphan_count; i++) epoch_orphans[i].release(epoch_orphans[i].ptr);
+    free(epoch_orphans);
+    epoch_orphans = NULL;
+    __atomic_store_n(&epoch_orphan_count, 0, __ATOMIC_RELAXED);
+    epoch_orphan_capacity = 0;
+    pthread_mutex_unlock(&epoch_orphans_lock);
+}
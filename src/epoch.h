@@ -0,0 +1,60 @@
+#ifndef EPOCH_H
+#define EPOCH_H
+
+#include "list_status.h"
+
+/*
+ * Reclamación de memoria por épocas, interna y común a todas las estructuras
+ * concurrentes. Un hilo que va a leer nodos compartidos entra en una sección
+ * con epoch_enter y sale con epoch_exit. Un nodo que ya se desenlazó se
+ * entrega a epoch_retire en lugar de liberarse: se libera cuando la época
+ * global avanzó dos veces desde entonces, porque para eso todos los hilos
+ * que estaban dentro de una sección tuvieron que salir.
+ *
+ * A diferencia del resto de la biblioteca, este módulo tiene estado global
+ * del proceso: la época, una tabla fija de EPOCH_MAX_THREADS registros (uno
+ * por hilo, desde su primer uso hasta que termina) y una lista de nodos
+ * huérfanos. Los nodos que un hilo deja pendientes al terminar pasan a esa
+ * lista y los libera cualquier otro hilo al recolectar; al terminar el
+ * proceso se libera todo lo que quede si ningún hilo sigue dentro de una
+ * sección.
+ *
+ * Un hilo que llega cuando ya hay EPOCH_MAX_THREADS hilos vivos registrados
+ * no obtiene registro: epoch_enter devuelve LIST_ERR_ALLOC, y las
+ * estructuras concurrentes lo propagan tal cual.
+ */
+
+#define EPOCH_MAX_THREADS 256 // hilos vivos que pueden usar estructuras concurrentes a la vez
+
+/**
+ * @brief Entra en una sección de lectura. Las secciones se pueden anidar.
+ *
+ * @return
+ * - LIST_OK si el hilo está dentro de una sección
+ * - LIST_ERR_ALLOC si ya hay EPOCH_MAX_THREADS hilos registrados
+ */
+ListStatus epoch_enter(void);
+
+/**
+ * @brief Sale de la sección abierta por el epoch_enter correspondiente.
+ */
+void epoch_exit(void);
+
+/**
+ * @brief Libera ptr con release cuando ningún hilo pueda seguir leyéndolo.
+ *
+ * ptr ya debe estar desenlazado de la estructura. El hilo no debe estar
+ * dentro de una sección: si no hay registro libre o memoria para apuntar
+ * ptr se espera a que pase una época completa y se libera en el momento.
+ */
+void epoch_retire(void *ptr, void (*release)(void *));
+
+/**
+ * @brief Espera a que salgan todos los hilos que estaban dentro de una sección y
+ *        libera los nodos pendientes del hilo que llama y los huérfanos.
+ *
+ * No debe llamarse dentro de una sección.
+ */
+void epoch_synchronize(void);
+
+#endif /* EPOCH_H */
@@ -0,0 +1,395 @@
+#include "idlist.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+
+#include "index_arena.h"
+
+/*
+ * Nodo compacto: los enlaces son índices de 32 bits en el arreglo de nodos
+ * (0 significa NULL), así que el nodo ocupa 12 bytes en lugar de los 24 de
+ * DList más la cabecera de malloc.
+ */
+typedef struct Node {
+    int value;
+    uint32_t next;
+    uint32_t prev;
+} Node;
+
+struct IDList {
+    IndexArena arena; // nodos de la lista
+    uint32_t head;
+    uint32_t tail;
+    int count;
+    uint32_t finger; // último nodo accedido por posición (0 si no hay)
+    int finger_pos;
+};
+
+static inline Node *idlist_node(IDList *list, uint32_t index) {
+    return index_arena_node(&list->arena, index);
+}
+
+IDList *idlist_create(void) {
+    IDList *list = malloc(sizeof(IDList)); // creamos la lista
+
+    if (!list) return NULL;
+
+    index_arena_init(&list->arena, sizeof(Node));
+    list->head = 0;
+    list->tail = 0;
+    list->count = 0;
+    list->finger = 0;
+    list->finger_pos = 0;
+    return list;
+}
+
+/* Devuelve un nodo libre o 0 con el error en status. */
+static uint32_t idlist_node_alloc(IDList *list, ListStatus *status) {
+    if (list->count == INT_MAX) {
+        *status = LIST_ERR_OUT_OF_RANGE;
+        return 0;
+    }
+
+    uint32_t node = index_arena_alloc(&list->arena);
+    if (!node) *status = LIST_ERR_ALLOC;
+    return node;
+}
+
+/* Enlaza node antes de after (después de tail si after es 0) y ajusta el dedo. */
+static void idlist_link(IDList *list, uint32_t node, uint32_t after, int pos) {
+    Node *n = idlist_node(list, node);
+    uint32_t before = after ? idlist_node(list, after)->prev : list->tail;
+
+    n->next = after;
+    n->prev = before;
+
+    if (before) idlist_node(list, before)->next = node;
+    else list->head = node;
+
+    if (after) idlist_node(list, after)->prev = node;
+    else list->tail = node;
+
+    list->count++;
+    if (list->finger && list->finger_pos >= pos) list->finger_pos++; // el dedo se recorre una posición
+}
+
+static void idlist_unlink(IDList *list, uint32_t node, int pos) {
+    Node *n = idlist_node(list, node);
+
+    if (n->prev) idlist_node(list, n->prev)->next = n->next;
+    else list->head = n->next;
+
+    if (n->next) idlist_node(list, n->next)->prev = n->prev;
+    else list->tail = n->prev;
+
+    list->count--;
+    if (list->finger == node) list->finger = 0;
+    else if (list->finger && list->finger_pos > pos) list->finger_pos--;
+}
+
+static ListStatus idlist_validate_position(IDList *list, int pos, int cond) {
+    if (cond == 0) {
+        if (pos > list->count + 1 || pos < 1) return LIST_ERR_OUT_OF_RANGE;
+    } else {
+        if (pos > list->count || pos < 1) return LIST_ERR_OUT_OF_RANGE;
+    }
+
+    return LIST_OK;
+}
+
+/*
+ * Devuelve el nodo en la posición pos (ya validada), partiendo del extremo o
+ * del dedo más cercano, igual que en DList.
+ */
+static uint32_t idlist_node_at(IDList *list, int pos) {
+    uint32_t actual = list->head;
+    int actual_pos = 1;
+    int distance = pos - 1; // distancia desde head
+
+    if (list->count - pos < distance) { // tail está más cerca
+        actual = list->tail;
+        actual_pos = list->count;
+        distance = list->count - pos;
+    }
+
+    if (list->finger && abs(pos - list->finger_pos) < distance) { // el dedo está más cerca
+        actual = list->finger;
+        actual_pos = list->finger_pos;
+    }
+
+    while (actual_pos < pos) { // avanzar hacia tail
+        actual = idlist_node(list, actual)->next;
+        actual_pos++;
+    }
+
+    while (actual_pos > pos) { // retroceder hacia head
+        actual = idlist_node(list, actual)->prev;
+        actual_pos--;
+    }
+
+    list->finger = actual;
+    list->finger_pos = pos;
+    return actual;
+}
+
+ListStatus idlist_size(IDList *list, int *count) {
+    if (!list) return LIST_ERR_NULL;
+
+    *count = list->count;
+    return LIST_OK;
+}
+
+ListStatus idlist_size_bytes(IDList *list, size_t *bytes) {
+    if (!list) return LIST_ERR_NULL;
+    if (!bytes) return LIST_ERR_NULL;
+
+    *bytes = sizeof(IDList) + index_arena_bytes(&list->arena); // tamaño de IDList + nodos reservados
+    return LIST_OK;
+}
+
+ListStatus idlist_is_empty(IDList *list, bool *is_empty) {
+    if (!list) return LIST_ERR_NULL;
+
+    *is_empty = (list->head == 0);
+    return LIST_OK;
+}
+
+ListStatus idlist_contains(IDList *list, int value, bool *found) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    uint32_t actual = list->head;
+
+    while (actual) {
+        Node *node = idlist_node(list, actual);
+
+        if (node->value == value) { // se encuentra
+            *found = true;
+            return LIST_OK;
+        }
+
+        actual = node->next;
+    }
+
+    *found = false;
+    return LIST_OK;
+}
+
+ListStatus idlist_push_back(IDList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+
+    ListStatus status = LIST_OK;
+    uint32_t new = idlist_node_alloc(list, &status); // nuevo nodo
+    if (!new) return status;
+
+    idlist_node(list, new)->value = value;
+    idlist_link(list, new, 0, list->count + 1); // enlazamos después de tail
+    return LIST_OK;
+}
+
+ListStatus idlist_push_front(IDList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+
+    ListStatus status = LIST_OK;
+    uint32_t new = idlist_node_alloc(list, &status); // nuevo nodo
+    if (!new) return status;
+
+    idlist_node(list, new)->value = value;
+    idlist_link(list, new, list->head, 1); // enlazamos como head
+    return LIST_OK;
+}
+
+ListStatus idlist_insert_in_position(IDList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (idlist_validate_position(list, pos, 0) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    if (pos == 1) { // insertar al inicio
+        return idlist_push_front(list, value);
+    }
+
+    if (pos == list->count + 1) { // insertar al final
+        return idlist_push_back(list, value);
+    }
+
+    // cualquiera entre head y tail
+    ListStatus status = LIST_OK;
+    uint32_t new = idlist_node_alloc(list, &status); // número a insertar
+    if (!new) return status;
+    idlist_node(list, new)->value = value;
+
+    uint32_t after_new = idlist_node_at(list, pos); // nodo que ocupa pos
+
+    idlist_link(list, new, after_new, pos);
+    list->finger = new; // new ocupa ahora pos
+    list->finger_pos = pos;
+    return LIST_OK;
+}
+
+ListStatus idlist_change_value(IDList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (idlist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    idlist_node(list, idlist_node_at(list, pos))->value = value;
+    return LIST_OK;
+}
+
+ListStatus idlist_search_for_value(IDList *list, int value, int *pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    uint32_t actual = list->head;
+    int pos_local = 0;
+
+    while (actual) {
+        Node *node = idlist_node(list, actual);
+
+        if (node->value == value) { // se encuentra
+            *pos = pos_local;
+            return LIST_OK;
+        }
+
+        actual = node->next;
+        pos_local++;
+    }
+
+    return LIST_ERR_NOT_FOUND;
+}
+
+ListStatus idlist_search_for_position(IDList *list, int pos, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (idlist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    *value = idlist_node(list, idlist_node_at(list, pos))->value;
+    return LIST_OK;
+}
+
+ListStatus idlist_front(IDList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    *value = idlist_node(list, list->head)->value;
+    return LIST_OK;
+}
+
+ListStatus idlist_back(IDList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->tail) return LIST_ERR_EMPTY;
+
+    *value = idlist_node(list, list->tail)->value;
+    return LIST_OK;
+}
+
+ListStatus idlist_free_in_position(IDList *list, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (idlist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    uint32_t actual = idlist_node_at(list, pos); // nodo a liberar
+
+    idlist_unlink(list, actual, pos);
+    index_arena_release(&list->arena, actual);
+    return LIST_OK;
+}
+
+ListStatus idlist_pop_front(IDList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    uint32_t actual = list->head;
+
+    *value = idlist_node(list, actual)->value;
+    idlist_unlink(list, actual, 1);
+    index_arena_release(&list->arena, actual);
+    return LIST_OK;
+}
+
+ListStatus idlist_pop_back(IDList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+    if (!list->tail) return LIST_ERR_EMPTY;
+
+    uint32_t actual = list->tail;
+
+    *value = idlist_node(list, actual)->value;
+    idlist_unlink(list, actual, list->count);
+    index_arena_release(&list->arena, actual);
+    return LIST_OK;
+}
+
+ListStatus idlist_clear(IDList *list) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    index_arena_reset(&list->arena); // liberamos los segmentos completos
+    list->head = 0;
+    list->tail = 0;
+    list->count = 0;
+    list->finger = 0;
+    list->finger_pos = 0;
+    return LIST_OK;
+}
+
+ListStatus idlist_sum(IDList *list, int *sum) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    uint32_t actual = list->head;
+    int total = 0;
+
+    while (actual) {
+        Node *node = idlist_node(list, actual);
+
+        total += node->value;
+        actual = node->next;
+    }
+
+    *sum = total;
+    return LIST_OK;
+}
+
+ListStatus idlist_to_array(IDList *list, int *out, size_t cap, size_t *written) {
+    if (!list) return LIST_ERR_NULL;
+    if (!written) return LIST_ERR_NULL;
+
+    *written = 0;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (!out && cap) return LIST_ERR_NULL;
+
+    uint32_t actual = list->head;
+    size_t i = 0;
+
+    while (actual && i < cap) {
+        Node *node = idlist_node(list, actual);
+
+        out[i++] = node->value;
+        actual = node->next;
+    }
+
+    *written = i;
+    return actual ? LIST_ERR_OUT_OF_RANGE : LIST_OK;
+}
+
+ListStatus idlist_destroy(IDList *list) {
+    if (!list) return LIST_ERR_NULL;
+
+    index_arena_reset(&list->arena);
+    free(list);
+    return LIST_OK;
+}
+
+void idlist_show(IDList *list) {
+    uint32_t actual = list->head;
+
+    printf("\n\nElementos de la lista: ");
+    printf("NULL <-> ");
+    while (actual) {
+        printf("%d <-> ", idlist_node(list, actual)->value);
+        actual = idlist_node(list, actual)->next;
+    }
+
+    printf("NULL");
+}
@@ -0,0 +1,106 @@
+#include "index_arena.h"
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#define INDEX_ARENA_FIRST_NODES 16 // nodos iniciales del primer segmento
+#define INDEX_ARENA_MAX_USED ((uint32_t)INT_MAX + 1) // posiciones int más el índice 0
+
+void index_arena_init(IndexArena *arena, size_t node_size) {
+    arena->node_size = node_size < sizeof(uint32_t) ? sizeof(uint32_t) : node_size;
+    arena->segments = NULL;
+    arena->segment_count = 0;
+    arena->segment_capacity = 0;
+    arena->first_nodes = 0;
+    arena->used = 1; // el índice 0 no se entrega
+    arena->free_nodes = 0;
+}
+
+static int index_arena_table_push(IndexArena *arena, unsigned char *segment) {
+    if (arena->segment_count == arena->segment_capacity) {
+        uint32_t capacity = arena->segment_capacity ? arena->segment_capacity * 2 : 4;
+        unsigned char **table = realloc(arena->segments, capacity * sizeof(unsigned char *));
+
+        if (!table) return 0;
+
+        arena->segments = table;
+        arena->segment_capacity = capacity;
+    }
+
+    arena->segments[arena->segment_count++] = segment;
+    return 1;
+}
+
+/* Agranda el primer segmento al doble, o reserva uno nuevo si ya está lleno. */
+static int index_arena_grow(IndexArena *arena) {
+    if (arena->segment_count == 0 || arena->first_nodes < INDEX_ARENA_SEGMENT) {
+        uint32_t nodes = arena->first_nodes ? arena->first_nodes * 2 : INDEX_ARENA_FIRST_NODES;
+        unsigned char *first = realloc(arena->segment_count ? arena->segments[0] : NULL, nodes * arena->node_size);
+
+        if (!first) return 0;
+
+        if (arena->segment_count == 0 && !index_arena_table_push(arena, first)) {
+            free(first);
+            return 0;
+        }
+
+        arena->segments[0] = first;
+        arena->first_nodes = nodes;
+        return 1;
+    }
+
+    unsigned char *segment = malloc((size_t)INDEX_ARENA_SEGMENT * arena->node_size);
+
+    if (!segment) return 0;
+    if (!index_arena_table_push(arena, segment)) {
+        free(segment);
+        return 0;
+    }
+
+    return 1;
+}
+
+uint32_t index_arena_alloc(IndexArena *arena) {
+    uint32_t index = arena->free_nodes;
+
+    if (index) { // reutilizamos un nodo liberado
+        memcpy(&arena->free_nodes, index_arena_node(arena, index), sizeof(uint32_t));
+        return index;
+    }
+
+    if (arena->used == INDEX_ARENA_MAX_USED) return 0;
+
+    index = arena->used;
+
+    uint32_t reserved = arena->segment_count <= 1 ? arena->first_nodes : arena->segment_count * INDEX_ARENA_SEGMENT;
+
+    if (index >= reserved && !index_arena_grow(arena)) return 0;
+
+    arena->used++;
+    return index;
+}
+
+void index_arena_release(IndexArena *arena, uint32_t index) {
+    memcpy(index_arena_node(arena, index), &arena->free_nodes, sizeof(uint32_t));
+    arena->free_nodes = index;
+}
+
+void index_arena_reset(IndexArena *arena) {
+    for (uint32_t i = 0; i < arena->segment_count; i++) {
+        free(arena->segments[i]);
+    }
+
+    free(arena->segments);
+    index_arena_init(arena, arena->node_size);
+}
+
+size_t index_arena_bytes(const IndexArena *arena) {
+    size_t bytes = (size_t)arena->segment_capacity * sizeof(unsigned char *);
+
+    if (arena->segment_count) bytes += (size_t)arena->first_nodes * arena->node_size;
+    if (arena->segment_count > 1) {
+        bytes += (size_t)(arena->segment_count - 1) * INDEX_ARENA_SEGMENT * arena->node_size;
+    }
+
+    return bytes;
+}
@@ -0,0 +1,67 @@
+#ifndef INDEX_ARENA_H
+#define INDEX_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Arreglo interno de nodos de tamaño fijo direccionados por índices de 32
+ * bits. Lo usan islist.c e idlist.c para enlazar nodos por índice en lugar
+ * de por puntero. Los nodos viven en segmentos de INDEX_ARENA_SEGMENT nodos
+ * que nunca se mueven, salvo el primero, que crece con realloc hasta llenar
+ * un segmento para que las listas cortas no reserven un segmento completo.
+ * El índice 0 está reservado y equivale a NULL.
+ */
+
+#define INDEX_ARENA_SHIFT 16
+#define INDEX_ARENA_SEGMENT (1u << INDEX_ARENA_SHIFT) // nodos por segmento
+#define INDEX_ARENA_MASK (INDEX_ARENA_SEGMENT - 1)
+
+typedef struct IndexArena {
+    size_t node_size; // tamaño de cada nodo (al menos 4 bytes)
+    unsigned char **segments; // tabla de segmentos
+    uint32_t segment_count; // segmentos reservados
+    uint32_t segment_capacity; // capacidad de la tabla
+    uint32_t first_nodes; // nodos reservados en el primer segmento
+    uint32_t used; // índices entregados alguna vez (empieza en 1)
+    uint32_t free_nodes; // índices liberados, enlazados en los primeros 4 bytes del nodo
+} IndexArena;
+
+/**
+ * @brief Deja el arreglo vacío, sin reservar memoria.
+ */
+void index_arena_init(IndexArena *arena, size_t node_size);
+
+/**
+ * @brief Obtiene un nodo libre.
+ *
+ * Puede mover el primer segmento: las direcciones obtenidas antes con
+ * index_arena_node dejan de ser válidas, los índices no.
+ *
+ * @return
+ * - Índice del nodo
+ * - 0 si falla malloc o ya se entregaron todos los índices
+ */
+uint32_t index_arena_alloc(IndexArena *arena);
+
+/**
+ * @brief Devuelve un nodo para reutilizarlo.
+ */
+void index_arena_release(IndexArena *arena, uint32_t index);
+
+/**
+ * @brief Libera todos los segmentos; el arreglo queda como recién iniciado.
+ */
+void index_arena_reset(IndexArena *arena);
+
+/**
+ * @brief Devuelve los bytes reservados (segmentos y tabla).
+ */
+size_t index_arena_bytes(const IndexArena *arena);
+
+/* Dirección del nodo index (distinto de 0). */
+static inline void *index_arena_node(const IndexArena *arena, uint32_t index) {
+    return arena->segments[index >> INDEX_ARENA_SHIFT] + (size_t)(index & INDEX_ARENA_MASK) * arena->node_size;
+}
+
+#endif /* INDEX_ARENA_H */
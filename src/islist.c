@@ -0,0 +1,339 @@
+#include "islist.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+
+#include "index_arena.h"
+
+/*
+ * Nodo compacto: el enlace es un índice de 32 bits en el arreglo de nodos
+ * (0 significa NULL), así que el nodo ocupa 8 bytes en lugar de los 16 de
+ * SList más la cabecera de malloc.
+ */
+typedef struct Node {
+    int value;
+    uint32_t next;
+} Node;
+
+struct ISList {
+    IndexArena arena; // nodos de la lista
+    uint32_t head;
+    uint32_t tail;
+    int count;
+};
+
+static inline Node *islist_node(ISList *list, uint32_t index) {
+    return index_arena_node(&list->arena, index);
+}
+
+ISList *islist_create(void) {
+    ISList *list = malloc(sizeof(ISList)); // creamos la lista
+
+    if (!list) return NULL;
+
+    index_arena_init(&list->arena, sizeof(Node));
+    list->head = 0;
+    list->tail = 0;
+    list->count = 0;
+    return list;
+}
+
+/* Devuelve un nodo libre con value o 0 con el error en status. */
+static uint32_t islist_node_alloc(ISList *list, int value, ListStatus *status) {
+    if (list->count == INT_MAX) {
+        *status = LIST_ERR_OUT_OF_RANGE;
+        return 0;
+    }
+
+    uint32_t node = index_arena_alloc(&list->arena);
+    if (!node) {
+        *status = LIST_ERR_ALLOC;
+        return 0;
+    }
+
+    islist_node(list, node)->value = value;
+    return node;
+}
+
+/* Enlaza node después de prev (como head si prev es 0). */
+static void islist_link_after(ISList *list, uint32_t prev, uint32_t node) {
+    Node *n = islist_node(list, node);
+
+    if (prev) {
+        Node *p = islist_node(list, prev);
+        n->next = p->next;
+        p->next = node;
+    } else { // nuevo head
+        n->next = list->head;
+        list->head = node;
+    }
+
+    if (!n->next) list->tail = node; // nuevo tail
+    list->count++;
+}
+
+/* Desenlaza el nodo que sigue a prev (head si prev es 0) y lo devuelve sin liberarlo. */
+static uint32_t islist_unlink_after(ISList *list, uint32_t prev) {
+    uint32_t node = prev ? islist_node(list, prev)->next : list->head;
+    uint32_t next = islist_node(list, node)->next;
+
+    if (prev) islist_node(list, prev)->next = next;
+    else list->head = next; // actualizamos head
+
+    if (list->tail == node) list->tail = prev; // actualizamos tail
+    list->count--;
+    return node;
+}
+
+static ListStatus islist_validate_position(ISList *list, int pos, int cond) {
+    if (cond == 0) {
+        if (pos > list->count + 1 || pos < 1) return LIST_ERR_OUT_OF_RANGE;
+    } else {
+        if (pos > list->count || pos < 1) return LIST_ERR_OUT_OF_RANGE;
+    }
+
+    return LIST_OK;
+}
+
+/* Devuelve el nodo en la posición pos (ya validada). */
+static uint32_t islist_node_at(ISList *list, int pos) {
+    if (pos == list->count) return list->tail;
+
+    uint32_t actual = list->head;
+
+    for (int i = 1; i < pos; i++) { // mover actual a la posición
+        actual = islist_node(list, actual)->next;
+    }
+
+    return actual;
+}
+
+ListStatus islist_size(ISList *list, int *count) {
+    if (!list) return LIST_ERR_NULL;
+
+    *count = list->count;
+    return LIST_OK;
+}
+
+ListStatus islist_size_bytes(ISList *list, size_t *bytes) {
+    if (!list) return LIST_ERR_NULL;
+    if (!bytes) return LIST_ERR_NULL;
+
+    *bytes = sizeof(ISList) + index_arena_bytes(&list->arena); // tamaño de ISList + nodos reservados
+    return LIST_OK;
+}
+
+ListStatus islist_is_empty(ISList *list, bool *is_empty) {
+    if (!list) return LIST_ERR_NULL;
+
+    *is_empty = (list->head == 0);
+    return LIST_OK;
+}
+
+ListStatus islist_contains(ISList *list, int value, bool *found) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    uint32_t actual = list->head;
+
+    while (actual) {
+        Node *node = islist_node(list, actual);
+
+        if (node->value == value) { // se encuentra
+            *found = true;
+            return LIST_OK;
+        }
+
+        actual = node->next;
+    }
+
+    *found = false;
+    return LIST_OK;
+}
+
+ListStatus islist_push_back(ISList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+
+    ListStatus status = LIST_OK;
+    uint32_t new = islist_node_alloc(list, value, &status); // nuevo nodo
+    if (!new) return status;
+
+    islist_link_after(list, list->tail, new); // enlazamos después de tail
+    return LIST_OK;
+}
+
+ListStatus islist_push_front(ISList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+
+    ListStatus status = LIST_OK;
+    uint32_t new = islist_node_alloc(list, value, &status); // nuevo nodo
+    if (!new) return status;
+
+    islist_link_after(list, 0, new); // enlazamos como head
+    return LIST_OK;
+}
+
+ListStatus islist_insert_in_position(ISList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (islist_validate_position(list, pos, 0) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    ListStatus status = LIST_OK;
+    uint32_t new = islist_node_alloc(list, value, &status); // número a insertar
+    if (!new) return status;
+
+    uint32_t before_new = pos > 1 ? islist_node_at(list, pos - 1) : 0; // posición antes de la indicada
+
+    islist_link_after(list, before_new, new);
+    return LIST_OK;
+}
+
+ListStatus islist_change_value(ISList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (islist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    islist_node(list, islist_node_at(list, pos))->value = value;
+    return LIST_OK;
+}
+
+ListStatus islist_search_for_value(ISList *list, int value, int *pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    uint32_t actual = list->head;
+    int pos_local = 0;
+
+    while (actual) {
+        Node *node = islist_node(list, actual);
+
+        if (node->value == value) { // se encuentra
+            *pos = pos_local;
+            return LIST_OK;
+        }
+
+        actual = node->next;
+        pos_local++;
+    }
+
+    return LIST_ERR_NOT_FOUND;
+}
+
+ListStatus islist_search_for_position(ISList *list, int pos, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (islist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    *value = islist_node(list, islist_node_at(list, pos))->value;
+    return LIST_OK;
+}
+
+ListStatus islist_front(ISList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    *value = islist_node(list, list->head)->value;
+    return LIST_OK;
+}
+
+ListStatus islist_back(ISList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->tail) return LIST_ERR_EMPTY;
+
+    *value = islist_node(list, list->tail)->value;
+    return LIST_OK;
+}
+
+ListStatus islist_free_in_position(ISList *list, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (islist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    uint32_t before_actual = pos > 1 ? islist_node_at(list, pos - 1) : 0; // nodo antes de pos
+
+    index_arena_release(&list->arena, islist_unlink_after(list, before_actual)); // liberamos
+    return LIST_OK;
+}
+
+ListStatus islist_pop_front(ISList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    uint32_t actual = islist_unlink_after(list, 0); // desenlazamos head
+
+    *value = islist_node(list, actual)->value;
+    index_arena_release(&list->arena, actual); // liberamos
+    return LIST_OK;
+}
+
+ListStatus islist_clear(ISList *list) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    index_arena_reset(&list->arena); // liberamos los segmentos completos
+    list->head = 0;
+    list->tail = 0;
+    list->count = 0;
+    return LIST_OK;
+}
+
+ListStatus islist_sum(ISList *list, int *sum) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    uint32_t actual = list->head;
+    int total = 0;
+
+    while (actual) {
+        Node *node = islist_node(list, actual);
+
+        total += node->value;
+        actual = node->next;
+    }
+
+    *sum = total;
+    return LIST_OK;
+}
+
+ListStatus islist_to_array(ISList *list, int *out, size_t cap, size_t *written) {
+    if (!list) return LIST_ERR_NULL;
+    if (!written) return LIST_ERR_NULL;
+
+    *written = 0;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (!out && cap) return LIST_ERR_NULL;
+
+    uint32_t actual = list->head;
+    size_t i = 0;
+
+    while (actual && i < cap) {
+        Node *node = islist_node(list, actual);
+
+        out[i++] = node->value;
+        actual = node->next;
+    }
+
+    *written = i;
+    return actual ? LIST_ERR_OUT_OF_RANGE : LIST_OK;
+}
+
+ListStatus islist_destroy(ISList *list) {
+    if (!list) return LIST_ERR_NULL;
+
+    index_arena_reset(&list->arena);
+    free(list);
+    return LIST_OK;
+}
+
+void islist_show(ISList *list) {
+    uint32_t actual = list->head;
+
+    printf("\n\nElementos de la lista: ");
+    while (actual) {
+        printf("%d -> ", islist_node(list, actual)->value);
+        actual = islist_node(list, actual)->next;
+    }
+
+    printf("NULL");
+}
@@ -0,0 +1,579 @@
+#define _POSIX_C_SOURCE 200809L // ftruncate, mmap y msync con -std=c11
+
+#include "mlist.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define MLIST_VERSION 1
+#define MLIST_BYTE_ORDER 0x01020304u // se lee distinto en un host de otro orden de bytes
+#define MLIST_HEADER_BYTES 4096 // la cabecera ocupa una página; los nodos empiezan alineados
+#define MLIST_INITIAL_CAPACITY 1024 // nodos del archivo recién creado
+#define MLIST_MAX_CAPACITY ((uint32_t)INT_MAX + 1) // INT_MAX nodos más el nodo 0
+
+static const char mlist_magic[8] = { 'L', 'N', 'K', 'L', 'M', 'A', 'P', '\0' };
+
+/*
+ * Nodo dentro del archivo. Los enlaces son índices en el arreglo de nodos
+ * (0 significa NULL, por eso el nodo 0 nunca se usa): siguen siendo válidos
+ * aunque el archivo se mapee en otra dirección. Las posiciones de la API son
+ * int, así que 32 bits alcanzan para indexar cualquier nodo; los tamaños y
+ * desplazamientos del archivo se calculan en 64 bits.
+ */
+typedef struct MNode {
+    int32_t value;
+    uint32_t next;
+    uint32_t prev;
+} MNode;
+
+typedef struct MListHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t node_size; // sizeof(MNode) al crear el archivo
+    uint32_t capacity; // nodos que caben en el archivo (incluye el nodo 0)
+    uint32_t used; // nodos entregados alguna vez; los de used en adelante nunca se tocaron
+    uint32_t head;
+    uint32_t tail;
+    uint32_t free_nodes; // nodos liberados, enlazados por next
+    int32_t count;
+} MListHeader;
+
+struct MList {
+    int fd;
+    unsigned char *map; // región mapeada: cabecera y nodos
+    size_t map_bytes;
+    MListHeader *header;
+    MNode *nodes;
+    uint32_t finger; // último nodo accedido por posición (0 si no hay)
+    int finger_pos;
+};
+
+static uint64_t mlist_file_bytes(uint32_t capacity) {
+    return MLIST_HEADER_BYTES + (uint64_t)capacity * sizeof(MNode);
+}
+
+static ListStatus mlist_map(MList *list, size_t bytes) {
+    void *map = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, list->fd, 0);
+    if (map == MAP_FAILED) return LIST_ERR_IO;
+
+    if (list->map) munmap(list->map, list->map_bytes); // la región anterior ya no hace falta
+
+    list->map = map;
+    list->map_bytes = bytes;
+    list->header = (MListHeader *)map;
+    list->nodes = (MNode *)(list->map + MLIST_HEADER_BYTES);
+    return LIST_OK;
+}
+
+static MList *mlist_handle(int fd) {
+    MList *list = malloc(sizeof(MList));
+
+    if (!list) return NULL;
+
+    list->fd = fd;
+    list->map = NULL;
+    list->map_bytes = 0;
+    list->header = NULL;
+    list->nodes = NULL;
+    list->finger = 0;
+    list->finger_pos = 0;
+    return list;
+}
+
+ListStatus mlist_create(const char *path, MList **out) {
+    if (!path) return LIST_ERR_NULL;
+    if (!out) return LIST_ERR_NULL;
+
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return LIST_ERR_IO;
+
+    MList *list = mlist_handle(fd);
+    if (!list) {
+        close(fd);
+        return LIST_ERR_ALLOC;
+    }
+
+    uint64_t bytes = mlist_file_bytes(MLIST_INITIAL_CAPACITY);
+    ListStatus status = ftruncate(fd, (off_t)bytes) == 0 ? mlist_map(list, (size_t)bytes) : LIST_ERR_IO;
+
+    if (status != LIST_OK) {
+        free(list);
+        close(fd);
+        return status;
+    }
+
+    MListHeader *header = list->header; // el archivo recién truncado viene en ceros
+
+    memcpy(header->magic, mlist_magic, sizeof(mlist_magic));
+    header->version = MLIST_VERSION;
+    header->byte_order = MLIST_BYTE_ORDER;
+    header->node_size = sizeof(MNode);
+    header->capacity = MLIST_INITIAL_CAPACITY;
+    header->used = 1; // el nodo 0 está reservado
+    header->head = 0;
+    header->tail = 0;
+    header->free_nodes = 0;
+    header->count = 0;
+
+    *out = list;
+    return LIST_OK;
+}
+
+/* Solo se revisa la cabecera, de modo que abrir cuesta lo mismo para cualquier tamaño. */
+static bool mlist_header_valid(const MListHeader *header, uint64_t file_bytes) {
+    if (memcmp(header->magic, mlist_magic, sizeof(mlist_magic)) != 0) return false;
+    if (header->version != MLIST_VERSION) return false;
+    if (header->byte_order != MLIST_BYTE_ORDER) return false;
+    if (header->node_size != sizeof(MNode)) return false;
+    if (header->capacity < 1 || header->capacity > MLIST_MAX_CAPACITY) return false;
+    if (mlist_file_bytes(header->capacity) > file_bytes) return false; // archivo truncado
+    if (header->used < 1 || header->used > header->capacity) return false;
+    if (header->head >= header->used || header->tail >= header->used) return false;
+    if (header->free_nodes >= header->used) return false;
+    if (header->count < 0 || (uint32_t)header->count >= header->used) return false;
+    return (header->count == 0) == (header->head == 0) && (header->head == 0) == (header->tail == 0);
+}
+
+ListStatus mlist_open(const char *path, MList **out) {
+    if (!path) return LIST_ERR_NULL;
+    if (!out) return LIST_ERR_NULL;
+
+    int fd = open(path, O_RDWR);
+    if (fd < 0) return LIST_ERR_IO;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return LIST_ERR_IO;
+    }
+    if (st.st_size < MLIST_HEADER_BYTES) {
+        close(fd);
+        return LIST_ERR_FORMAT;
+    }
+
+    MList *list = mlist_handle(fd);
+    if (!list) {
+        close(fd);
+        return LIST_ERR_ALLOC;
+    }
+
+    ListStatus status = mlist_map(list, MLIST_HEADER_BYTES); // primero solo la cabecera
+
+    if (status == LIST_OK && !mlist_header_valid(list->header, (uint64_t)st.st_size)) status = LIST_ERR_FORMAT;
+    if (status == LIST_OK && mlist_file_bytes(list->header->capacity) > SIZE_MAX) status = LIST_ERR_IO;
+    if (status == LIST_OK) status = mlist_map(list, (size_t)mlist_file_bytes(list->header->capacity));
+
+    if (status != LIST_OK) {
+        if (list->map) munmap(list->map, list->map_bytes);
+        free(list);
+        close(fd);
+        return status;
+    }
+
+    *out = list;
+    return LIST_OK;
+}
+
+ListStatus mlist_flush(MList *list) {
+    if (!list) return LIST_ERR_NULL;
+
+    if (msync(list->map, list->map_bytes, MS_SYNC) != 0) return LIST_ERR_IO;
+    return LIST_OK;
+}
+
+/*
+ * Duplica la capacidad del archivo. El archivo se agranda antes de mapearlo
+ * de nuevo; si algo falla la lista sigue intacta con la capacidad anterior.
+ */
+static ListStatus mlist_grow(MList *list) {
+    uint32_t capacity = list->header->capacity;
+
+    if (capacity >= MLIST_MAX_CAPACITY) return LIST_ERR_OUT_OF_RANGE;
+
+    uint32_t new_capacity = capacity > MLIST_MAX_CAPACITY / 2 ? MLIST_MAX_CAPACITY : capacity * 2;
+    uint64_t bytes = mlist_file_bytes(new_capacity);
+
+    if (bytes > SIZE_MAX) return LIST_ERR_IO; // no cabe en el espacio de direcciones
+    if (ftruncate(list->fd, (off_t)bytes) != 0) return LIST_ERR_IO;
+
+    ListStatus status = mlist_map(list, (size_t)bytes);
+    if (status != LIST_OK) return status;
+
+    list->header->capacity = new_capacity;
+    return LIST_OK;
+}
+
+/* Devuelve un nodo libre (reutilizado o nuevo) o 0 con el error en status. */
+static uint32_t mlist_node_alloc(MList *list, ListStatus *status) {
+    MListHeader *header = list->header;
+
+    if (header->count == INT_MAX) {
+        *status = LIST_ERR_OUT_OF_RANGE;
+        return 0;
+    }
+
+    if (header->free_nodes) { // reutilizamos un nodo liberado
+        uint32_t node = header->free_nodes;
+        header->free_nodes = list->nodes[node].next;
+        return node;
+    }
+
+    if (header->used == header->capacity) {
+        *status = mlist_grow(list);
+        if (*status != LIST_OK) return 0;
+        header = list->header; // la cabecera cambió de dirección
+    }
+
+    return header->used++;
+}
+
+static void mlist_node_release(MList *list, uint32_t node) {
+    list->nodes[node].next = list->header->free_nodes;
+    list->header->free_nodes = node;
+}
+
+/* Enlaza node antes de after (después de tail si after es 0) y ajusta el dedo. */
+static void mlist_link(MList *list, uint32_t node, uint32_t after, int pos) {
+    MListHeader *header = list->header;
+    MNode *n = &list->nodes[node];
+    uint32_t before = after ? list->nodes[after].prev : header->tail;
+
+    n->next = after;
+    n->prev = before;
+
+    if (before) list->nodes[before].next = node;
+    else header->head = node;
+
+    if (after) list->nodes[after].prev = node;
+    else header->tail = node;
+
+    header->count++;
+    if (list->finger && list->finger_pos >= pos) list->finger_pos++; // el dedo se recorre una posición
+}
+
+static void mlist_unlink(MList *list, uint32_t node, int pos) {
+    MListHeader *header = list->header;
+    MNode *n = &list->nodes[node];
+
+    if (n->prev) list->nodes[n->prev].next = n->next;
+    else header->head = n->next;
+
+    if (n->next) list->nodes[n->next].prev = n->prev;
+    else header->tail = n->prev;
+
+    header->count--;
+    if (list->finger == node) list->finger = 0;
+    else if (list->finger && list->finger_pos > pos) list->finger_pos--;
+}
+
+static ListStatus mlist_validate_position(MList *list, int pos, int cond) {
+    int count = list->header->count;
+
+    if (cond == 0) {
+        if (pos > count + 1 || pos < 1) return LIST_ERR_OUT_OF_RANGE;
+    } else {
+        if (pos > count || pos < 1) return LIST_ERR_OUT_OF_RANGE;
+    }
+
+    return LIST_OK;
+}
+
+/*
+ * Devuelve el nodo en la posición pos (ya validada), partiendo del extremo o
+ * del dedo más cercano, igual que en DList.
+ */
+static uint32_t mlist_node_at(MList *list, int pos) {
+    MListHeader *header = list->header;
+    uint32_t actual = header->head;
+    int actual_pos = 1;
+    int distance = pos - 1; // distancia desde head
+
+    if (header->count - pos < distance) { // tail está más cerca
+        actual = header->tail;
+        actual_pos = header->count;
+        distance = header->count - pos;
+    }
+
+    if (list->finger && abs(pos - list->finger_pos) < distance) { // el dedo está más cerca
+        actual = list->finger;
+        actual_pos = list->finger_pos;
+    }
+
+    while (actual_pos < pos) { // avanzar hacia tail
+        actual = list->nodes[actual].next;
+        actual_pos++;
+    }
+
+    while (actual_pos > pos) { // retroceder hacia head
+        actual = list->nodes[actual].prev;
+        actual_pos--;
+    }
+
+    list->finger = actual;
+    list->finger_pos = pos;
+    return actual;
+}
+
+ListStatus mlist_size(MList *list, int *count) {
+    if (!list) return LIST_ERR_NULL;
+
+    *count = list->header->count;
+    return LIST_OK;
+}
+
+ListStatus mlist_size_bytes(MList *list, size_t *bytes) {
+    if (!list) return LIST_ERR_NULL;
+    if (!bytes) return LIST_ERR_NULL;
+
+    *bytes = sizeof(MList) + list->map_bytes; // manejador + archivo mapeado
+    return LIST_OK;
+}
+
+ListStatus mlist_is_empty(MList *list, bool *is_empty) {
+    if (!list) return LIST_ERR_NULL;
+
+    *is_empty = (list->header->head == 0);
+    return LIST_OK;
+}
+
+ListStatus mlist_contains(MList *list, int value, bool *found) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->header->head) return LIST_ERR_EMPTY;
+
+    uint32_t actual = list->header->head;
+
+    while (actual) {
+        if (list->nodes[actual].value == value) { // se encuentra
+            *found = true;
+            return LIST_OK;
+        }
+
+        actual = list->nodes[actual].next;
+    }
+
+    *found = false;
+    return LIST_OK;
+}
+
+ListStatus mlist_push_back(MList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+
+    ListStatus status = LIST_OK;
+    uint32_t new = mlist_node_alloc(list, &status); // nuevo nodo
+    if (!new) return status;
+
+    list->nodes[new].value = value;
+    mlist_link(list, new, 0, list->header->count + 1); // enlazamos después de tail
+    return LIST_OK;
+}
+
+ListStatus mlist_push_front(MList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+
+    ListStatus status = LIST_OK;
+    uint32_t new = mlist_node_alloc(list, &status); // nuevo nodo
+    if (!new) return status;
+
+    list->nodes[new].value = value;
+    mlist_link(list, new, list->header->head, 1); // enlazamos como head
+    return LIST_OK;
+}
+
+ListStatus mlist_insert_in_position(MList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (mlist_validate_position(list, pos, 0) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    if (pos == 1) { // insertar al inicio
+        return mlist_push_front(list, value);
+    }
+
+    if (pos == list->header->count + 1) { // insertar al final
+        return mlist_push_back(list, value);
+    }
+
+    // cualquiera entre head y tail; se reserva antes de buscar porque crecer vuelve a mapear
+    ListStatus status = LIST_OK;
+    uint32_t new = mlist_node_alloc(list, &status);
+    if (!new) return status;
+    list->nodes[new].value = value;
+
+    uint32_t after_new = mlist_node_at(list, pos); // nodo que ocupa pos
+
+    mlist_link(list, new, after_new, pos);
+    list->finger = new; // new ocupa ahora pos
+    list->finger_pos = pos;
+    return LIST_OK;
+}
+
+ListStatus mlist_change_value(MList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (mlist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    list->nodes[mlist_node_at(list, pos)].value = value;
+    return LIST_OK;
+}
+
+ListStatus mlist_search_for_value(MList *list, int value, int *pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->header->head) return LIST_ERR_EMPTY;
+
+    uint32_t actual = list->header->head;
+    int pos_local = 0;
+
+    while (actual) {
+        if (list->nodes[actual].value == value) { // se encuentra
+            *pos = pos_local;
+            return LIST_OK;
+        }
+
+        actual = list->nodes[actual].next;
+        pos_local++;
+    }
+
+    return LIST_ERR_NOT_FOUND;
+}
+
+ListStatus mlist_search_for_position(MList *list, int pos, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->header->head) return LIST_ERR_EMPTY;
+    if (mlist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    *value = list->nodes[mlist_node_at(list, pos)].value;
+    return LIST_OK;
+}
+
+ListStatus mlist_front(MList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->header->head) return LIST_ERR_EMPTY;
+
+    *value = list->nodes[list->header->head].value;
+    return LIST_OK;
+}
+
+ListStatus mlist_back(MList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->header->tail) return LIST_ERR_EMPTY;
+
+    *value = list->nodes[list->header->tail].value;
+    return LIST_OK;
+}
+
+ListStatus mlist_free_in_position(MList *list, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->header->head) return LIST_ERR_EMPTY;
+    if (mlist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    uint32_t actual = mlist_node_at(list, pos); // nodo a liberar
+
+    mlist_unlink(list, actual, pos);
+    mlist_node_release(list, actual);
+    return LIST_OK;
+}
+
+ListStatus mlist_pop_front(MList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+    if (!list->header->head) return LIST_ERR_EMPTY;
+
+    uint32_t actual = list->header->head;
+
+    *value = list->nodes[actual].value;
+    mlist_unlink(list, actual, 1);
+    mlist_node_release(list, actual);
+    return LIST_OK;
+}
+
+ListStatus mlist_pop_back(MList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+    if (!list->header->tail) return LIST_ERR_EMPTY;
+
+    uint32_t actual = list->header->tail;
+
+    *value = list->nodes[actual].value;
+    mlist_unlink(list, actual, list->header->count);
+    mlist_node_release(list, actual);
+    return LIST_OK;
+}
+
+ListStatus mlist_clear(MList *list) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->header->head) return LIST_ERR_EMPTY;
+
+    MListHeader *header = list->header;
+
+    header->head = 0; // todos los nodos vuelven a estar sin usar, sin recorrerlos
+    header->tail = 0;
+    header->free_nodes = 0;
+    header->used = 1;
+    header->count = 0;
+    list->finger = 0;
+    list->finger_pos = 0;
+    return LIST_OK;
+}
+
+ListStatus mlist_sum(MList *list, int *sum) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->header->head) return LIST_ERR_EMPTY;
+
+    uint32_t actual = list->header->head;
+    int total = 0;
+
+    while (actual) {
+        total += list->nodes[actual].value;
+        actual = list->nodes[actual].next;
+    }
+
+    *sum = total;
+    return LIST_OK;
+}
+
+ListStatus mlist_to_array(MList *list, int *out, size_t cap, size_t *written) {
+    if (!list) return LIST_ERR_NULL;
+    if (!written) return LIST_ERR_NULL;
+
+    *written = 0;
+    if (!list->header->head) return LIST_ERR_EMPTY;
+    if (!out && cap) return LIST_ERR_NULL;
+
+    uint32_t actual = list->header->head;
+    size_t i = 0;
+
+    while (actual && i < cap) {
+        out[i++] = list->nodes[actual].value;
+        actual = list->nodes[actual].next;
+    }
+
+    *written = i;
+    return actual ? LIST_ERR_OUT_OF_RANGE : LIST_OK;
+}
+
+ListStatus mlist_close(MList *list) {
+    if (!list) return LIST_ERR_NULL;
+
+    munmap(list->map, list->map_bytes);
+    close(list->fd);
+    free(list);
+    return LIST_OK;
+}
+
+void mlist_show(MList *list) {
+    uint32_t actual = list->header->head;
+
+    printf("\n\nElementos de la lista: ");
+    printf("NULL <-> ");
+    while (actual) {
+        printf("%d <-> ", list->nodes[actual].value);
+        actual = list->nodes[actual].next;
+    }
+
+    printf("NULL");
+}
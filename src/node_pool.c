@@ -0,0 +1,124 @@
+#include "node_pool.h"
+#include <stdlib.h>
+
+#define NODE_POOL_DEFAULT_BLOCK 1024
+
+struct NodeSlab {
+    NodeSlab *next; // slab siguiente
+    size_t bytes; // bytes del slab (incluida la cabecera)
+};
+
+NodePool *node_pool_create(size_t node_size, size_t block_nodes) {
+    NodePool *pool = malloc(sizeof(NodePool)); // creamos el pool
+
+    if (!pool) return NULL;
+
+    // el nodo debe poder guardar el enlace de la lista de libres
+    if (node_size < sizeof(void *)) node_size = sizeof(void *);
+    node_size = (node_size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+
+    pool->node_size = node_size;
+    pool->block_nodes = block_nodes ? block_nodes : NODE_POOL_DEFAULT_BLOCK;
+    pool->slabs = NULL;
+    pool->free_nodes = NULL;
+    pool->cursor = NULL;
+    pool->remaining = 0;
+    pool->bytes = 0;
+    return pool;
+}
+
+static char *node_pool_add_slab(NodePool *pool, size_t nodes) {
+    size_t bytes = sizeof(NodeSlab) + nodes * pool->node_size;
+    NodeSlab *slab = malloc(bytes); // nuevo slab
+
+    if (!slab) return NULL;
+
+    slab->next = pool->slabs;
+    slab->bytes = bytes;
+    pool->slabs = slab;
+    pool->bytes += bytes;
+    return (char *)(slab + 1); // los nodos empiezan tras la cabecera
+}
+
+static int node_pool_grow(NodePool *pool) {
+    char *nodes = node_pool_add_slab(pool, pool->block_nodes);
+
+    if (!nodes) return 0;
+
+    // los nodos sin usar del slab anterior pasan a la lista de libres
+    while (pool->remaining) {
+        node_pool_release(pool, pool->cursor);
+        pool->cursor += pool->node_size;
+        pool->remaining--;
+    }
+
+    pool->cursor = nodes;
+    pool->remaining = pool->block_nodes;
+    return 1;
+}
+
+void *node_pool_alloc(NodePool *pool) {
+    void *node = pool->free_nodes;
+
+    if (node) { // reutilizamos un nodo liberado
+        pool->free_nodes = *(void **)node;
+        return node;
+    }
+
+    if (!pool->remaining && !node_pool_grow(pool)) return NULL;
+
+    node = pool->cursor;
+    pool->cursor += pool->node_size;
+    pool->remaining--;
+    return node;
+}
+
+void *node_pool_alloc_run(NodePool *pool, size_t n) {
+    char *run = NULL;
+
+    if (pool->remaining < n) {
+        if (n > pool->block_nodes) { // slab propio para el bloque
+            return node_pool_add_slab(pool, n);
+        }
+
+        if (!node_pool_grow(pool)) return NULL;
+    }
+
+    run = pool->cursor;
+    pool->cursor += n * pool->node_size;
+    pool->remaining -= n;
+    return run;
+}
+
+void node_pool_release(NodePool *pool, void *node) {
+    *(void **)node = pool->free_nodes; // enlazamos en la lista de libres
+    pool->free_nodes = node;
+}
+
+void node_pool_reset(NodePool *pool) {
+    NodeSlab *slab = pool->slabs;
+    NodeSlab *next = NULL;
+
+    while (slab) {
+        next = slab->next; // slab siguiente
+        free(slab); // liberamos el slab completo
+        slab = next;
+    }
+
+    pool->slabs = NULL;
+    pool->free_nodes = NULL;
+    pool->cursor = NULL;
+    pool->remaining = 0;
+    pool->bytes = 0;
+}
+
+size_t node_pool_bytes(const NodePool *pool) {
+    return sizeof(NodePool) + pool->bytes;
+}
+
+void node_pool_destroy(NodePool *pool) {
+    if (!pool) return;
+
+    node_pool_reset(pool);
+    free(pool);
+}
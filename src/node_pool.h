@@ -0,0 +1,76 @@
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <stddef.h>
+
+/*
+ * Pool interno de nodos de tamaño fijo. No forma parte de la API pública:
+ * lo usan slist.c y dlist.c para reservar nodos por slabs en lugar de hacer
+ * un malloc por cada nodo.
+ */
+
+typedef struct NodeSlab NodeSlab;
+
+typedef struct NodePool {
+    size_t node_size; // tamaño de cada nodo (alineado a puntero)
+    size_t block_nodes; // nodos por slab
+    NodeSlab *slabs; // slabs reservados
+    void *free_nodes; // nodos liberados listos para reutilizar
+    char *cursor; // siguiente nodo sin usar del slab actual
+    size_t remaining; // nodos sin usar en el slab actual
+    size_t bytes; // bytes reservados en slabs
+} NodePool;
+
+/**
+ * @brief Crea un pool de nodos.
+ *
+ * @param node_size Tamaño de cada nodo
+ * @param block_nodes Nodos por slab (0 usa el valor por defecto)
+ *
+ * @return
+ * - Puntero al pool si se creó correctamente
+ * - NULL si falla malloc
+ */
+NodePool *node_pool_create(size_t node_size, size_t block_nodes);
+
+/**
+ * @brief Obtiene un nodo del pool.
+ *
+ * @return
+ * - Puntero al nodo
+ * - NULL si falla malloc al reservar un slab nuevo
+ */
+void *node_pool_alloc(NodePool *pool);
+
+/**
+ * @brief Obtiene n nodos contiguos del pool.
+ *
+ * Los nodos se pueden devolver después uno a uno con node_pool_release.
+ *
+ * @return
+ * - Puntero al primer nodo
+ * - NULL si falla malloc (el pool no cambia)
+ */
+void *node_pool_alloc_run(NodePool *pool, size_t n);
+
+/**
+ * @brief Devuelve un nodo al pool para reutilizarlo.
+ */
+void node_pool_release(NodePool *pool, void *node);
+
+/**
+ * @brief Libera todos los slabs del pool en O(número de slabs).
+ */
+void node_pool_reset(NodePool *pool);
+
+/**
+ * @brief Devuelve los bytes reservados por el pool (slabs y cabecera).
+ */
+size_t node_pool_bytes(const NodePool *pool);
+
+/**
+ * @brief Libera todos los slabs y el pool.
+ */
+void node_pool_destroy(NodePool *pool);
+
+#endif /* NODE_POOL_H */
@@ -0,0 +1,130 @@
+#include "par_pool.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define PAR_POOL_LINE 64 // bytes por línea de caché
+
+/*
+ * Bloque de tareas pendientes de un hilo: [begin, end) empaquetado como
+ * begin << 32 | end para tomarlo o robarlo con un solo CAS. Una tarea
+ * ejecutada nunca vuelve a un bloque, así que un CAS no puede confundir un
+ * bloque viejo con uno nuevo. Cada bloque va en su propia línea de caché.
+ */
+typedef struct ParRange {
+    uint64_t range;
+} __attribute__((aligned(PAR_POOL_LINE))) ParRange;
+
+typedef struct ParShared {
+    ParRange ranges[PAR_POOL_MAX_THREADS];
+    unsigned threads;
+    ParTask run;
+    void *ctx;
+} ParShared;
+
+typedef struct ParWorker {
+    ParShared *shared;
+    unsigned id;
+} ParWorker;
+
+static inline uint64_t par_pool_pack(uint32_t begin, uint32_t end) {
+    return (uint64_t)begin << 32 | end;
+}
+
+/* Toma la primera tarea del bloque propio; false si está vacío. */
+static bool par_pool_take(ParRange *own, size_t *task) {
+    uint64_t range = __atomic_load_n(&own->range, __ATOMIC_ACQUIRE);
+
+    for (;;) {
+        uint32_t begin = (uint32_t)(range >> 32);
+        uint32_t end = (uint32_t)range;
+
+        if (begin >= end) return false;
+
+        if (__atomic_compare_exchange_n(&own->range, &range, par_pool_pack(begin + 1, end), true,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            *task = begin;
+            return true;
+        }
+    }
+}
+
+/* Roba la mitad final del bloque de algún otro hilo y la deja como bloque propio. */
+static bool par_pool_steal(ParShared *shared, unsigned id) {
+    for (unsigned i = 1; i < shared->threads; i++) {
+        ParRange *victim = &shared->ranges[(id + i) % shared->threads];
+        uint64_t range = __atomic_load_n(&victim->range, __ATOMIC_ACQUIRE);
+
+        for (;;) {
+            uint32_t begin = (uint32_t)(range >> 32);
+            uint32_t end = (uint32_t)range;
+
+            if (begin >= end) break; // vacío: probamos con el siguiente
+
+            uint32_t split = end - (end - begin + 1) / 2; // nos llevamos [split, end)
+
+            if (__atomic_compare_exchange_n(&victim->range, &range, par_pool_pack(begin, split), true,
+                                            __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                __atomic_store_n(&shared->ranges[id].range, par_pool_pack(split, end), __ATOMIC_RELEASE);
+                return true;
+            }
+        }
+    }
+
+    return false; // todos vacíos: las tareas restantes ya tienen dueño
+}
+
+static void *par_pool_worker(void *arg) {
+    ParWorker *worker = arg;
+    ParShared *shared = worker->shared;
+    ParRange *own = &shared->ranges[worker->id];
+    size_t task;
+
+    do {
+        while (par_pool_take(own, &task)) shared->run(shared->ctx, task);
+    } while (par_pool_steal(shared, worker->id));
+
+    return NULL;
+}
+
+unsigned par_pool_threads(unsigned threads, size_t tasks) {
+    if (tasks <= 1) return 1; // no hace falta consultar los procesadores
+
+    if (threads == 0) { // un hilo por procesador
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? (unsigned)online : 1;
+    }
+
+    if (threads > PAR_POOL_MAX_THREADS) threads = PAR_POOL_MAX_THREADS;
+    if (threads > tasks) threads = (unsigned)tasks;
+    if (threads == 0) threads = 1;
+    return threads;
+}
+
+void par_pool_run(unsigned threads, size_t tasks, ParTask run, void *ctx) {
+    ParShared shared;
+    ParWorker workers[PAR_POOL_MAX_THREADS];
+    pthread_t handles[PAR_POOL_MAX_THREADS];
+    bool started[PAR_POOL_MAX_THREADS];
+
+    shared.threads = threads;
+    shared.run = run;
+    shared.ctx = ctx;
+
+    for (unsigned t = 0; t < threads; t++) { // bloques contiguos del mismo tamaño
+        shared.ranges[t].range = par_pool_pack((uint32_t)(tasks * t / threads), (uint32_t)(tasks * (t + 1) / threads));
+        workers[t].shared = &shared;
+        workers[t].id = t;
+    }
+
+    for (unsigned t = 1; t < threads; t++) {
+        started[t] = pthread_create(&handles[t], NULL, par_pool_worker, &workers[t]) == 0;
+    }
+
+    par_pool_worker(&workers[0]); // el hilo que llama también trabaja
+
+    for (unsigned t = 1; t < threads; t++) {
+        if (started[t]) pthread_join(handles[t], NULL);
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef PAR_POOL_H
+#define PAR_POOL_H
+
+#include <stddef.h>
+
+/*
+ * Reparto interno de tareas entre hilos con robo de trabajo. No forma parte
+ * de la API pública: lo usan slist.c y dlist.c para los recorridos en
+ * paralelo. Cada hilo empieza con un bloque contiguo de tareas y las toma
+ * por el inicio; cuando se le acaban le roba la mitad final del bloque a
+ * otro hilo, así que un tramo más caro que los demás no deja a los otros
+ * hilos esperando.
+ */
+
+#define PAR_POOL_MAX_THREADS 64
+
+/**
+ * @brief Tarea del reparto.
+ *
+ * @param ctx Contexto, el mismo que se pasó a par_pool_run
+ * @param task Índice de la tarea, de 0 a tasks - 1
+ */
+typedef void (*ParTask)(void *ctx, size_t task);
+
+/**
+ * @brief Número de hilos a usar para tasks tareas.
+ *
+ * @param threads Hilos pedidos (0 usa los procesadores disponibles)
+ * @param tasks Número de tareas
+ *
+ * @return Entre 1 y PAR_POOL_MAX_THREADS, y nunca más que tasks
+ */
+unsigned par_pool_threads(unsigned threads, size_t tasks);
+
+/**
+ * @brief Ejecuta las tareas 0..tasks - 1 repartidas entre threads hilos y
+ *        vuelve cuando terminaron todas.
+ *
+ * El hilo que llama es uno de los threads. Si no se puede crear algún hilo,
+ * sus tareas las roban los demás. Cada tarea se ejecuta exactamente una
+ * vez, en un orden no especificado.
+ *
+ * @param threads Hilos a usar (de par_pool_threads)
+ * @param tasks Número de tareas
+ * @param run Función que ejecuta una tarea
+ * @param ctx Contexto que se pasa a run
+ */
+void par_pool_run(unsigned threads, size_t tasks, ParTask run, void *ctx);
+
+#endif /* PAR_POOL_H */
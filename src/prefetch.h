@@ -0,0 +1,17 @@
+#ifndef PREFETCH_H
+#define PREFETCH_H
+
+/*
+ * Prefetch por software para los recorridos largos. En compiladores sin
+ * __builtin_prefetch la macro no hace nada.
+ */
+
+#define PREFETCH_DISTANCE 8 // nodos de adelanto
+
+#if defined(__GNUC__) || defined(__clang__)
+#define prefetch_read(addr) __builtin_prefetch((addr), 0, 1)
+#else
+#define prefetch_read(addr) ((void)(addr))
+#endif
+
+#endif /* PREFETCH_H */
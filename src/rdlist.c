@@ -0,0 +1,349 @@
+#include "rdlist.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "epoch.h"
+
+#define RDLIST_LINE 64 // bytes por línea de caché
+
+/*
+ * Los lectores solo siguen next, que se escribe con release una vez que el
+ * nodo está completo. prev, tail y count son del escritor, que los usa con
+ * el mutex tomado.
+ */
+typedef struct Node {
+    int value;
+    struct Node *next;
+    struct Node *prev;
+} Node;
+
+/*
+ * head va solo en su línea de caché: la leen todos los lectores y el mutex
+ * de los escritores no debe invalidarla.
+ */
+struct RDList {
+    Node *head;
+    char pad_head[RDLIST_LINE - sizeof(Node *)];
+    pthread_mutex_t lock; // serializa a los escritores
+    Node *tail;
+    int count;
+};
+
+static inline Node *rdlist_next(Node *const *link) {
+    return __atomic_load_n(link, __ATOMIC_ACQUIRE);
+}
+
+/* Publica target en link: los lectores que lo encuentren ven el nodo completo. */
+static inline void rdlist_publish(Node **link, Node *target) {
+    __atomic_store_n(link, target, __ATOMIC_RELEASE);
+}
+
+/* Enlace que apunta a node: head o el next del anterior. */
+static Node **rdlist_link_to(RDList *list, Node *node) {
+    return node->prev ? &node->prev->next : &list->head;
+}
+
+/* Nodo en pos (1 <= pos <= count); solo con el mutex tomado. */
+static Node *rdlist_node_at(RDList *list, int pos) {
+    Node *actual;
+
+    if (pos <= list->count / 2) { // se recorre desde el extremo más cercano
+        actual = list->head;
+        for (int i = 1; i < pos; i++) actual = actual->next;
+    } else {
+        actual = list->tail;
+        for (int i = list->count; i > pos; i--) actual = actual->prev;
+    }
+
+    return actual;
+}
+
+/* Quita node de la lista; los lectores que ya estaban en él siguen avanzando por su next. */
+static void rdlist_unlink(RDList *list, Node *node) {
+    rdlist_publish(rdlist_link_to(list, node), node->next);
+
+    if (node->next) node->next->prev = node->prev;
+    else list->tail = node->prev;
+
+    __atomic_store_n(&list->count, list->count - 1, __ATOMIC_RELAXED);
+}
+
+/* Enlaza new antes de after (al final si after es NULL). */
+static void rdlist_link(RDList *list, Node *new, Node *after) {
+    new->next = after;
+    new->prev = after ? after->prev : list->tail;
+
+    if (after) after->prev = new;
+    else list->tail = new;
+
+    rdlist_publish(rdlist_link_to(list, new), new); // a partir de aquí los lectores lo ven
+    __atomic_store_n(&list->count, list->count + 1, __ATOMIC_RELAXED);
+}
+
+RDList *rdlist_create(void) {
+    RDList *list = malloc(sizeof(RDList)); // creamos la lista
+
+    if (!list) return NULL;
+
+    if (pthread_mutex_init(&list->lock, NULL) != 0) {
+        free(list);
+        return NULL;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+    return list;
+}
+
+ListStatus rdlist_size(RDList *list, int *count) {
+    if (!list) return LIST_ERR_NULL;
+
+    *count = __atomic_load_n(&list->count, __ATOMIC_RELAXED);
+    return LIST_OK;
+}
+
+ListStatus rdlist_is_empty(RDList *list, bool *is_empty) {
+    if (!list) return LIST_ERR_NULL;
+
+    *is_empty = __atomic_load_n(&list->head, __ATOMIC_RELAXED) == NULL; // no se lee el nodo
+    return LIST_OK;
+}
+
+ListStatus rdlist_contains(RDList *list, int value, bool *found) {
+    if (!list) return LIST_ERR_NULL;
+    if (epoch_enter() != LIST_OK) return LIST_ERR_ALLOC;
+
+    Node *actual = rdlist_next(&list->head);
+
+    if (!actual) {
+        epoch_exit();
+        return LIST_ERR_EMPTY;
+    }
+
+    *found = false;
+
+    while (actual) {
+        if (actual->value == value) { // se encuentra
+            *found = true;
+            break;
+        }
+
+        actual = rdlist_next(&actual->next);
+    }
+
+    epoch_exit();
+    return LIST_OK;
+}
+
+ListStatus rdlist_sum(RDList *list, int *sum) {
+    if (!list) return LIST_ERR_NULL;
+    if (epoch_enter() != LIST_OK) return LIST_ERR_ALLOC;
+
+    Node *actual = rdlist_next(&list->head);
+    int total = 0;
+
+    if (!actual) {
+        epoch_exit();
+        return LIST_ERR_EMPTY;
+    }
+
+    while (actual) {
+        total += actual->value;
+        actual = rdlist_next(&actual->next);
+    }
+
+    epoch_exit();
+    *sum = total;
+    return LIST_OK;
+}
+
+ListStatus rdlist_search_for_position(RDList *list, int pos, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (epoch_enter() != LIST_OK) return LIST_ERR_ALLOC;
+
+    Node *actual = rdlist_next(&list->head);
+    ListStatus status = LIST_ERR_OUT_OF_RANGE;
+
+    if (!actual) {
+        status = LIST_ERR_EMPTY;
+    } else if (pos >= 1) {
+        for (int i = 1; actual && i < pos; i++) actual = rdlist_next(&actual->next);
+
+        if (actual) {
+            *value = actual->value;
+            status = LIST_OK;
+        }
+    }
+
+    epoch_exit();
+    return status;
+}
+
+ListStatus rdlist_to_array(RDList *list, int *out, size_t cap, size_t *written) {
+    if (!list) return LIST_ERR_NULL;
+    if (!out || !written) return LIST_ERR_NULL;
+
+    *written = 0;
+    if (epoch_enter() != LIST_OK) return LIST_ERR_ALLOC;
+
+    Node *actual = rdlist_next(&list->head);
+    size_t n = 0;
+
+    if (!actual) {
+        epoch_exit();
+        return LIST_ERR_EMPTY;
+    }
+
+    while (actual && n < cap) {
+        out[n++] = actual->value;
+        actual = rdlist_next(&actual->next);
+    }
+
+    epoch_exit();
+    *written = n;
+    return actual ? LIST_ERR_OUT_OF_RANGE : LIST_OK;
+}
+
+ListStatus rdlist_push_back(RDList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+
+    Node *new = malloc(sizeof(Node)); // nuevo nodo
+    if (!new) return LIST_ERR_ALLOC;
+
+    new->value = value;
+
+    pthread_mutex_lock(&list->lock);
+    rdlist_link(list, new, NULL);
+    pthread_mutex_unlock(&list->lock);
+    return LIST_OK;
+}
+
+ListStatus rdlist_push_front(RDList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+
+    Node *new = malloc(sizeof(Node)); // nuevo nodo
+    if (!new) return LIST_ERR_ALLOC;
+
+    new->value = value;
+
+    pthread_mutex_lock(&list->lock);
+    rdlist_link(list, new, list->head);
+    pthread_mutex_unlock(&list->lock);
+    return LIST_OK;
+}
+
+ListStatus rdlist_insert_in_position(RDList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+
+    Node *new = malloc(sizeof(Node)); // número a insertar
+    if (!new) return LIST_ERR_ALLOC;
+
+    new->value = value;
+
+    pthread_mutex_lock(&list->lock);
+    if (pos < 1 || pos > list->count + 1) {
+        pthread_mutex_unlock(&list->lock);
+        free(new);
+        return LIST_ERR_OUT_OF_RANGE;
+    }
+
+    rdlist_link(list, new, pos == list->count + 1 ? NULL : rdlist_node_at(list, pos));
+    pthread_mutex_unlock(&list->lock);
+    return LIST_OK;
+}
+
+ListStatus rdlist_change_value(RDList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+
+    Node *new = malloc(sizeof(Node)); // copia con el nuevo valor
+    if (!new) return LIST_ERR_ALLOC;
+
+    new->value = value;
+
+    pthread_mutex_lock(&list->lock);
+    if (pos < 1 || pos > list->count) {
+        pthread_mutex_unlock(&list->lock);
+        free(new);
+        return LIST_ERR_OUT_OF_RANGE;
+    }
+
+    Node *old = rdlist_node_at(list, pos);
+
+    new->next = old->next;
+    new->prev = old->prev;
+    rdlist_publish(rdlist_link_to(list, old), new); // los lectores pasan a la copia
+
+    if (old->next) old->next->prev = new;
+    else list->tail = new;
+
+    pthread_mutex_unlock(&list->lock);
+
+    epoch_retire(old, free);
+    return LIST_OK;
+}
+
+/* Quita el nodo en pos (el último si last) y lo libera al terminar el periodo de gracia. */
+static ListStatus rdlist_remove_at(RDList *list, int pos, bool last, int *value) {
+    pthread_mutex_lock(&list->lock);
+    if (!list->head) {
+        pthread_mutex_unlock(&list->lock);
+        return LIST_ERR_EMPTY;
+    }
+
+    if (last) pos = list->count;
+    if (pos < 1 || pos > list->count) {
+        pthread_mutex_unlock(&list->lock);
+        return LIST_ERR_OUT_OF_RANGE;
+    }
+
+    Node *actual = rdlist_node_at(list, pos); // nodo a liberar
+
+    if (value) *value = actual->value;
+    rdlist_unlink(list, actual);
+    pthread_mutex_unlock(&list->lock);
+
+    epoch_retire(actual, free);
+    return LIST_OK;
+}
+
+ListStatus rdlist_free_in_position(RDList *list, int pos) {
+    if (!list) return LIST_ERR_NULL;
+
+    return rdlist_remove_at(list, pos, false, NULL);
+}
+
+ListStatus rdlist_pop_front(RDList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+
+    return rdlist_remove_at(list, 1, false, value);
+}
+
+ListStatus rdlist_pop_back(RDList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+
+    return rdlist_remove_at(list, 0, true, value);
+}
+
+void rdlist_synchronize(void) {
+    epoch_synchronize();
+}
+
+ListStatus rdlist_destroy(RDList *list) {
+    if (!list) return LIST_ERR_NULL;
+
+    Node *actual = list->head;
+
+    while (actual) {
+        Node *next = actual->next;
+        free(actual);
+        actual = next;
+    }
+
+    pthread_mutex_destroy(&list->lock);
+    free(list);
+    return LIST_OK;
+}
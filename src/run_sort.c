@@ -0,0 +1,49 @@
+#include "run_sort.h"
+#include <string.h>
+
+#define RUN_SORT_INSERTION 16 // tramos que se ordenan por inserción
+
+static void run_sort_insertion(int *values, size_t n, ListCompare cmp) {
+    for (size_t i = 1; i < n; i++) {
+        int value = values[i];
+        size_t j = i;
+
+        while (j > 0 && !run_sort_before(values[j - 1], value, cmp)) { // solo se mueven los mayores
+            values[j] = values[j - 1];
+            j--;
+        }
+
+        values[j] = value;
+    }
+}
+
+void run_sort(int *values, int *tmp, size_t n, ListCompare cmp) {
+    for (size_t i = 0; i < n; i += RUN_SORT_INSERTION) {
+        size_t len = n - i < RUN_SORT_INSERTION ? n - i : RUN_SORT_INSERTION;
+        run_sort_insertion(values + i, len, cmp);
+    }
+
+    int *src = values;
+    int *dst = tmp;
+
+    for (size_t width = RUN_SORT_INSERTION; width < n; width *= 2) { // mezclas alternando búferes
+        for (size_t left = 0; left < n; left += 2 * width) {
+            size_t mid = left + width < n ? left + width : n;
+            size_t right = left + 2 * width < n ? left + 2 * width : n;
+            size_t a = left, b = mid, k = left;
+
+            while (a < mid && b < right) {
+                dst[k++] = run_sort_before(src[a], src[b], cmp) ? src[a++] : src[b++];
+            }
+
+            while (a < mid) dst[k++] = src[a++];
+            while (b < right) dst[k++] = src[b++];
+        }
+
+        int *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != values) memcpy(values, src, n * sizeof(int));
+}
@@ -0,0 +1,29 @@
+#ifndef RUN_SORT_H
+#define RUN_SORT_H
+
+#include <stddef.h>
+
+#include "list_callbacks.h"
+
+/*
+ * Ordenamiento interno de tramos cortos para *_sort. Las listas copian hasta
+ * RUN_SORT_BLOCK valores consecutivos en un búfer de la pila, los ordenan aquí
+ * y los devuelven a los mismos nodos, de modo que el merge sort sobre los
+ * enlaces empieza con tramos ya ordenados en lugar de nodos sueltos.
+ */
+
+#define RUN_SORT_BLOCK 512 // enteros por tramo
+
+/* a va antes que b o es equivalente (orden estable). */
+static inline int run_sort_before(int a, int b, ListCompare cmp) {
+    return cmp ? cmp(a, b) <= 0 : a <= b;
+}
+
+/**
+ * @brief Ordena values de forma estable usando tmp (n enteros) como auxiliar.
+ *
+ * @param cmp Función de comparación (NULL para orden ascendente)
+ */
+void run_sort(int *values, int *tmp, size_t n, ListCompare cmp);
+
+#endif /* RUN_SORT_H */
@@ -2,16 +2,33 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <limits.h>
+#include <stdint.h>
+
+#include "aggregate.h"
+#include "node_pool.h"
+#include "par_pool.h"
+#include "prefetch.h"
+#include "run_sort.h"
+#include "snapshot.h"
+#include "value_index.h"
 
 typedef struct Node {
     int value;
     struct Node *next;
 } Node;
 
+#define SLIST_SORT_WAYS 8 // cadenas que mezcla a la vez el merge sort
+#define SLIST_SORT_LEVELS 11 // niveles del contador del merge sort (SLIST_SORT_WAYS^11 tramos)
+#define SLIST_PAR_SPLIT 4 // tramos por hilo en slist_par_sum, para que haya qué robar
+#define SLIST_PAR_MIN_CHUNK 16384 // elementos mínimos por tramo
+
 struct SList {
     Node *head;
     Node *tail;
     int count;
+    NodePool *pool; // NULL si los nodos se reservan con malloc
+    ValueIndex *values; // índice hash por valor (NULL si no se usa)
 };
 
 SList *slist_create(void) {
@@ -22,9 +39,122 @@ SList *slist_create(void) {
     list->head = NULL;
     list->tail = NULL;
     list->count = 0;
+    list->pool = NULL;
+    list->values = NULL;
     return list;
 }
 
+SList *slist_create_pooled(size_t block_nodes) {
+    SList *list = slist_create(); // creamos la lista
+
+    if (!list) return NULL;
+
+    list->pool = node_pool_create(sizeof(Node), block_nodes);
+    if (!list->pool) {
+        free(list);
+        return NULL;
+    }
+
+    return list;
+}
+
+ListStatus slist_enable_value_index(SList *list) {
+    if (!list) return LIST_ERR_NULL;
+    if (list->values) return LIST_OK; // ya existe
+
+    ValueIndex *values = value_index_create();
+    if (!values) return LIST_ERR_ALLOC;
+
+    for (Node *actual = list->head; actual; actual = actual->next) { // registramos lo que ya hay
+        if (!value_index_add(values, actual->value)) {
+            value_index_destroy(values);
+            return LIST_ERR_ALLOC;
+        }
+    }
+
+    list->values = values;
+    return LIST_OK;
+}
+
+static Node *slist_node_alloc(SList *list) {
+    if (list->pool) return node_pool_alloc(list->pool);
+
+    return malloc(sizeof(Node));
+}
+
+static void slist_node_release(SList *list, Node *node) {
+    if (list->pool) {
+        node_pool_release(list->pool, node);
+        return;
+    }
+
+    free(node);
+}
+
+/* Registra value en el índice por valor; sin memoria el índice se descarta. */
+static void slist_values_add(SList *list, int value) {
+    if (list->values && !value_index_add(list->values, value)) {
+        value_index_destroy(list->values);
+        list->values = NULL;
+    }
+}
+
+static void slist_values_remove(SList *list, int value) {
+    if (list->values) value_index_remove(list->values, value);
+}
+
+/* Cambia el valor de node manteniendo el índice por valor. */
+static void slist_node_set(SList *list, Node *node, int value) {
+    slist_values_remove(list, node->value);
+    node->value = value;
+    slist_values_add(list, value);
+}
+
+/*
+ * Enlaza new después de prev (NULL para insertarlo al inicio). Todas las
+ * inserciones pasan por aquí para mantener head, tail y count.
+ */
+static void slist_link_after(SList *list, Node *prev, Node *new) {
+    if (prev) {
+        new->next = prev->next;
+        prev->next = new;
+    } else { // nuevo head
+        new->next = list->head;
+        list->head = new;
+    }
+
+    if (!new->next) list->tail = new; // nuevo tail
+    list->count++;
+    slist_values_add(list, new->value);
+}
+
+/*
+ * Desenlaza el nodo que sigue a prev (head si prev es NULL) y lo devuelve
+ * sin liberarlo.
+ */
+static Node *slist_unlink_after(SList *list, Node *prev) {
+    Node *node = prev ? prev->next : list->head;
+
+    if (prev) prev->next = node->next;
+    else list->head = node->next; // actualizamos head
+
+    if (list->tail == node) list->tail = prev; // actualizamos tail
+    list->count--;
+    slist_values_remove(list, node->value);
+    return node;
+}
+
+/* Devuelve el nodo en la posición pos (ya validada). */
+static Node *slist_node_at(SList *list, int pos) {
+    Node *actual = list->head;
+
+    for (int i = 1; i < pos; i++) { // mover actual a la posición
+        actual = actual->next;
+    }
+
+    return actual;
+}
+
 ListStatus slist_size(SList *list, int *count) {
     if (!list) return LIST_ERR_NULL;
 
@@ -36,7 +166,14 @@ ListStatus slist_size_bytes(SList *list, size_t *bytes) {
     if (!list) return LIST_ERR_NULL;
     if (!bytes) return LIST_ERR_NULL;
 
-    *bytes = sizeof(SList) + list->count * sizeof(Node); // tamaño de SList + tamaño de todos los Node
+    size_t values_bytes = list->values ? value_index_bytes(list->values) : 0; // índice por valor
+
+    if (list->pool) { // tamaño de SList + slabs del pool
+        *bytes = sizeof(SList) + node_pool_bytes(list->pool) + values_bytes;
+        return LIST_OK;
+    }
+
+    *bytes = sizeof(SList) + list->count * sizeof(Node) + values_bytes; // tamaño de SList + tamaño de todos los Node
     return LIST_OK;
 }
 
@@ -51,6 +188,11 @@ ListStatus slist_contains(SList *list, int value, bool *found) {
     if (!list) return LIST_ERR_NULL;
     if (!list->head) return LIST_ERR_EMPTY;
 
+    if (list->values) { // respuesta directa del índice
+        *found = value_index_count(list->values, value) > 0;
+        return LIST_OK;
+    }
+
     Node *actual = list->head;
 
     while (actual) { // mover actual a la posición
@@ -69,45 +211,110 @@ ListStatus slist_contains(SList *list, int value, bool *found) {
 ListStatus slist_push_back(SList *list, int value) {
     if (!list) return LIST_ERR_NULL;
 
-    Node *new = malloc(sizeof(Node)); // nuevo nodo
+    Node *new = slist_node_alloc(list); // nuevo nodo
     if (!new) return LIST_ERR_ALLOC;
 
     new->value = value;
-    new->next = NULL;
-
-    if (!list->head) { // lista vacía
-        list->head = new;
-        list->tail = new;
-    } else {
-        list->tail->next = new;
-        list->tail = new;
-    }
-
-    list->count++;
+    slist_link_after(list, list->tail, new); // enlazamos después de tail
     return LIST_OK;
 }
 
 ListStatus slist_push_front(SList *list, int value) {
     if (!list) return LIST_ERR_NULL;
 
-    Node *new = malloc(sizeof(Node)); // nuevo nodo
+    Node *new = slist_node_alloc(list); // nuevo nodo
     if (!new) return LIST_ERR_ALLOC;
 
     new->value = value;
-    new->next = NULL; // ---- revisar ----
+    slist_link_after(list, NULL, new); // enlazamos como head
+    return LIST_OK;
+}
 
-    if (!list->head) { // lista vacía
-        list->head = new;
-        list->tail = new;
-    } else {
-        new->next = list->head;
-        list->head = new;
+/*
+ * Reserva n nodos con los valores de values y los deja enlazados entre sí.
+ * En una lista con pool los nodos salen de un único bloque contiguo; si no,
+ * de un malloc por nodo. Si falla una reserva no queda nada reservado.
+ */
+static Node *slist_chain_create(SList *list, const int *values, size_t n, Node **last) {
+    Node *first = NULL;
+
+    if (list->pool) {
+        Node *run = node_pool_alloc_run(list->pool, n); // bloque de n nodos
+        if (!run) return NULL;
+
+        for (size_t i = 0; i < n - 1; i++) { // enlazamos el bloque
+            run[i].value = values[i];
+            run[i].next = &run[i + 1];
+        }
+
+        run[n - 1].value = values[n - 1];
+        run[n - 1].next = NULL;
+        *last = &run[n - 1];
+        return run;
     }
 
-    list->count++;
+    Node *prev = NULL;
+
+    for (size_t i = 0; i < n; i++) {
+        Node *new = malloc(sizeof(Node)); // nuevo nodo
+
+        if (!new) { // liberamos lo que ya se reservó
+            while (first) {
+                prev = first->next;
+                free(first);
+                first = prev;
+            }
+
+            return NULL;
+        }
+
+        new->value = values[i];
+        new->next = NULL;
+
+        if (prev) prev->next = new;
+        else first = new;
+        prev = new;
+    }
+
+    *last = prev;
+    return first;
+}
+
+static ListStatus slist_extend_at(SList *list, const int *values, size_t n, bool front) {
+    if (!list) return LIST_ERR_NULL;
+    if (n == 0) return LIST_OK;
+    if (!values) return LIST_ERR_NULL;
+    if (n > (size_t)(INT_MAX - list->count)) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *last = NULL;
+    Node *first = slist_chain_create(list, values, n, &last);
+    if (!first) return LIST_ERR_ALLOC;
+
+    if (front) { // la cadena queda antes de head
+        last->next = list->head;
+        list->head = first;
+        if (!list->tail) list->tail = last;
+    } else { // la cadena queda después de tail
+        if (list->tail) list->tail->next = first;
+        else list->head = first;
+        list->tail = last;
+    }
+
+    list->count += (int)n;
+    for (size_t i = 0; i < n; i++) {
+        slist_values_add(list, values[i]);
+    }
     return LIST_OK;
 }
 
+ListStatus slist_extend(SList *list, const int *values, size_t n) {
+    return slist_extend_at(list, values, n, false);
+}
+
+ListStatus slist_extend_front(SList *list, const int *values, size_t n) {
+    return slist_extend_at(list, values, n, true);
+}
+
 static ListStatus slist_validate_position(SList *list, int pos, int cond) {
     if (cond == 0) {
         if (pos > list->count + 1 || pos < 1) return LIST_ERR_OUT_OF_RANGE;
@@ -131,21 +338,13 @@ ListStatus slist_insert_in_position(SList *list, int value, int pos) {
     }
 
     // cualquiera entre head y tail
-    Node *new = malloc(sizeof(Node)); // número a insertar
+    Node *new = slist_node_alloc(list); // número a insertar
     if (!new) return LIST_ERR_ALLOC;
     new->value = value;
 
-    Node *before_new = list->head; // posición antes de la indicada
-
-    int i = 1;
-    while (before_new && i < pos - 1) { // mover before_new antes de pos
-        before_new = before_new->next;
-        i++;
-    }
+    Node *before_new = slist_node_at(list, pos - 1); // posición antes de la indicada
 
-    new->next = before_new->next; // apuntamos al siguiente de new
-    before_new->next = new; // apuntamos a new
-    list->count++;
+    slist_link_after(list, before_new, new);
     return LIST_OK;
 }
 
@@ -153,19 +352,16 @@ ListStatus slist_change_value(SList *list, int value, int pos) {
     if (!list) return LIST_ERR_NULL;
     if (slist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
 
-    Node *actual = list->head;
+    Node *actual = slist_node_at(list, pos); // mover actual a la posición
 
-    for (int i = 0; i < pos - 1; i++) { // mover actual a la posición
-        actual = actual->next;
-    }
-
-    actual->value = value;
+    slist_node_set(list, actual, value);
     return LIST_OK;
 }
 
 ListStatus slist_search_for_value(SList *list, int value, int *pos) {
     if (!list) return LIST_ERR_NULL;
     if (!list->head) return LIST_ERR_EMPTY;
+    if (list->values && !value_index_count(list->values, value)) return LIST_ERR_NOT_FOUND;
 
     Node *actual = list->head;
     int pos_local = 0;
@@ -194,13 +390,7 @@ ListStatus slist_search_for_position(SList *list, int pos, int *value) {
     if (!list->head) return LIST_ERR_EMPTY;
     if (slist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
 
-    Node *actual = list->head;
-
-    int i = 1;
-    while (actual && i < pos) { // mover actual a pos
-        actual = actual->next;
-        i++;
-    }
+    Node *actual = slist_node_at(list, pos); // mover actual a pos
 
     *value = actual->value;
     return LIST_OK;
@@ -225,48 +415,282 @@ ListStatus slist_free_in_position(SList *list, int pos) {
     if (!list) return LIST_ERR_NULL;
     if (!list->head) return LIST_ERR_EMPTY;
 
-    Node *actual = list->head;
-    Node *after_actual = NULL;
-    Node *before_actual = NULL;
+    if (slist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
 
-    if (pos == list->count) { // último de la lista
-        int i = 1;
-        while (actual && i < pos - 1) { // mover actual antes de pos
-            actual = actual->next;
-            i++;
+    Node *before_actual = NULL; // nodo antes de pos (NULL si pos es head)
+    if (pos > 1) before_actual = slist_node_at(list, pos - 1);
+
+    slist_node_release(list, slist_unlink_after(list, before_actual)); // liberamos
+    return LIST_OK;
+}
+
+ListStatus slist_pop_front(SList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    Node *actual = slist_unlink_after(list, NULL); // desenlazamos head
+
+    *value = actual->value;
+    slist_node_release(list, actual); // liberamos
+    return LIST_OK;
+}
+
+ListStatus slist_pop_front_n(SList *list, int *out, size_t n) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (n > (size_t)list->count) return LIST_ERR_OUT_OF_RANGE;
+
+    for (size_t i = 0; i < n; i++) {
+        Node *actual = slist_unlink_after(list, NULL); // desenlazamos head
+
+        if (out) out[i] = actual->value;
+        slist_node_release(list, actual); // liberamos
+    }
+
+    return LIST_OK;
+}
+
+/*
+ * Los nodos solo se pueden reenlazar de una lista a otra si ninguna usa pool:
+ * un nodo de pool pertenece a los slabs de su lista.
+ */
+static bool slist_can_relink(const SList *dst, const SList *src) {
+    return !dst->pool && !src->pool;
+}
+
+/* Copia en nodos nuevos de dst los k valores de la cadena que empieza en first. */
+static Node *slist_chain_copy(SList *dst, Node *first, int k, Node **last) {
+    Node *copy = NULL;
+    Node *prev = NULL;
+
+    for (int i = 0; i < k; i++, first = first->next) {
+        Node *new = slist_node_alloc(dst); // nuevo nodo
+
+        if (!new) { // devolvemos lo que ya se reservó
+            while (copy) {
+                prev = copy->next;
+                slist_node_release(dst, copy);
+                copy = prev;
+            }
+
+            return NULL;
         }
 
-        after_actual = actual->next; // apuntamos al último
-        free(after_actual); // liberamos al último
+        new->value = first->value;
+        new->next = NULL;
 
-        list->tail = actual; // actualizamos tail
-        list->tail->next = NULL; // apuntamos a NULL
-        list->count--;
-        return LIST_OK;
+        if (prev) prev->next = new;
+        else copy = new;
+        prev = new;
+    }
+
+    *last = prev;
+    return copy;
+}
+
+/*
+ * Desenlaza de src la cadena de k nodos que sigue a prev (desde head si prev
+ * es NULL) y termina en last, sin liberarla. Devuelve su primer nodo.
+ */
+static Node *slist_detach_after(SList *src, Node *prev, Node *last, int k) {
+    Node *first = prev ? prev->next : src->head;
+
+    if (prev) prev->next = last->next;
+    else src->head = last->next; // era el primero
+
+    if (src->tail == last) src->tail = prev; // era el último
+
+    last->next = NULL;
+    src->count -= k;
+
+    if (src->values) {
+        for (Node *actual = first; actual; actual = actual->next) {
+            slist_values_remove(src, actual->value);
+        }
+    }
+
+    return first;
+}
+
+/* Enlaza la cadena first..last de k nodos después de prev (al inicio si prev es NULL). */
+static void slist_attach_after(SList *dst, Node *prev, Node *first, Node *last, int k) {
+    if (prev) {
+        last->next = prev->next;
+        prev->next = first;
+    } else { // nuevo head
+        last->next = dst->head;
+        dst->head = first;
     }
 
-    if (pos == 1) { // primero de la lista
-        actual = list->head;
-        list->head = list->head->next; // actualizamos head
-        free(actual); // liberamos al primero
-        list->count--;
+    if (!last->next) dst->tail = last; // nuevo tail
+    dst->count += k;
+
+    if (dst->values) {
+        for (Node *actual = first; actual != last->next; actual = actual->next) {
+            slist_values_add(dst, actual->value);
+        }
+    }
+}
+
+/*
+ * Mueve la cadena de k nodos que sigue a src_prev y termina en last al final
+ * de dst. Sin pool se reenlazan los nodos; con pool se copian los valores
+ * antes de tocar src, de modo que un fallo de malloc no cambia nada.
+ */
+static ListStatus slist_move_to_back(SList *dst, SList *src, Node *src_prev, Node *last, int k) {
+    Node *first = src_prev ? src_prev->next : src->head;
+
+    if (slist_can_relink(dst, src)) {
+        slist_detach_after(src, src_prev, last, k);
+        slist_attach_after(dst, dst->tail, first, last, k);
         return LIST_OK;
     }
 
-    if (slist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+    Node *copy_last = NULL;
+    Node *copy = slist_chain_copy(dst, first, k, &copy_last);
+    if (!copy) return LIST_ERR_ALLOC;
 
-    // cualquiera entre head y tail
-    int i = 1;
-    while (actual && i < pos - 1) { // mover actual antes de pos
-        actual = actual->next;
-        i++;
+    slist_detach_after(src, src_prev, last, k);
+
+    while (first) { // liberamos los originales
+        Node *next = first->next;
+        slist_node_release(src, first);
+        first = next;
     }
 
-    before_actual = actual; // apuntamos al anterior
-    after_actual = actual->next->next; // apuntamos al siguiente
-    free(actual->next); // liberamos
-    before_actual->next = after_actual; // unimos las listas
-    list->count--;
+    slist_attach_after(dst, dst->tail, copy, copy_last, k);
+    return LIST_OK;
+}
+
+ListStatus slist_concat(SList *dst, SList *src) {
+    if (!dst || !src) return LIST_ERR_NULL;
+    if (dst == src) return LIST_ERR_OUT_OF_RANGE;
+    if (!src->head) return LIST_OK; // nada que mover
+    if (src->count > INT_MAX - dst->count) return LIST_ERR_OUT_OF_RANGE;
+
+    return slist_move_to_back(dst, src, NULL, src->tail, src->count);
+}
+
+ListStatus slist_split_at(SList *list, int pos, SList **out_tail) {
+    if (!list) return LIST_ERR_NULL;
+    if (!out_tail) return LIST_ERR_NULL;
+    if (slist_validate_position(list, pos, 0) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    SList *tail = list->pool ? slist_create_pooled(list->pool->block_nodes) : slist_create(); // misma configuración que list
+
+    if (!tail) return LIST_ERR_ALLOC;
+
+    if (list->values && slist_enable_value_index(tail) != LIST_OK) {
+        slist_destroy(tail);
+        return LIST_ERR_ALLOC;
+    }
+
+    if (pos <= list->count) {
+        Node *before_pos = pos > 1 ? slist_node_at(list, pos - 1) : NULL; // último que se queda
+        ListStatus status = slist_move_to_back(tail, list, before_pos, list->tail, list->count - pos + 1);
+
+        if (status != LIST_OK) {
+            slist_destroy(tail);
+            return status;
+        }
+    }
+
+    *out_tail = tail;
+    return LIST_OK;
+}
+
+static bool slist_equal_value(int value, void *ctx) {
+    return value == *(const int *)ctx;
+}
+
+/*
+ * Libera una cadena de nodos ya desenlazados. Si la lista quedó vacía y usa
+ * pool se liberan los slabs completos sin recorrer la cadena.
+ */
+static void slist_chain_release(SList *list, Node *chain) {
+    if (list->pool && list->count == 0) {
+        node_pool_reset(list->pool);
+        return;
+    }
+
+    while (chain) {
+        Node *next = chain->next;
+        slist_node_release(list, chain);
+        chain = next;
+    }
+}
+
+/*
+ * Desenlaza en un solo recorrido los nodos que cumplen pred, hasta limit
+ * nodos, y los libera al final. Devuelve cuántos se eliminaron.
+ */
+static size_t slist_remove_matching(SList *list, ListPredicate pred, void *ctx, size_t limit) {
+    Node *prev = NULL;
+    Node *actual = list->head;
+    Node *removed = NULL; // cadena de nodos desenlazados
+    size_t n = 0;
+
+    while (actual && n < limit) {
+        Node *next = actual->next;
+
+        if (pred(actual->value, ctx)) {
+            if (prev) prev->next = next;
+            else list->head = next; // era el primero
+
+            slist_values_remove(list, actual->value);
+            actual->next = removed;
+            removed = actual;
+            n++;
+        } else {
+            prev = actual;
+        }
+
+        actual = next;
+    }
+
+    if (!actual) list->tail = prev; // se recorrió hasta el final
+    list->count -= (int)n;
+    slist_chain_release(list, removed);
+    return n;
+}
+
+ListStatus slist_remove_if(SList *list, ListPredicate pred, void *ctx, size_t *removed) {
+    if (!list) return LIST_ERR_NULL;
+    if (!pred) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    size_t n = slist_remove_matching(list, pred, ctx, SIZE_MAX);
+
+    if (removed) *removed = n;
+    return LIST_OK;
+}
+
+ListStatus slist_remove_value(SList *list, int value, size_t *removed) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    size_t limit = list->values ? (size_t)value_index_count(list->values, value) : SIZE_MAX; // apariciones conocidas
+    size_t n = limit ? slist_remove_matching(list, slist_equal_value, &value, limit) : 0;
+
+    if (removed) *removed = n;
+    return LIST_OK;
+}
+
+ListStatus slist_remove_range(SList *list, int from, int to) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (from < 1 || to > list->count || from > to) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *before_from = from > 1 ? slist_node_at(list, from - 1) : NULL; // último que se queda antes del rango
+    Node *last = before_from ? before_from->next : list->head;
+
+    for (int i = from; i < to; i++) { // último nodo del rango
+        last = last->next;
+    }
+
+    Node *chain = slist_detach_after(list, before_from, last, to - from + 1);
+    slist_chain_release(list, chain);
     return LIST_OK;
 }
 
@@ -274,6 +698,15 @@ ListStatus slist_clear(SList *list) {
     if (!list) return LIST_ERR_NULL;
     if (!list->head) return LIST_ERR_EMPTY;
 
+    if (list->pool) { // liberamos los slabs completos
+        node_pool_reset(list->pool);
+        list->head = NULL;
+        list->tail = NULL;
+        list->count = 0;
+        if (list->values) value_index_clear(list->values);
+        return LIST_OK;
+    }
+
     Node *actual = list->head;
     Node *next = NULL;
 
@@ -286,6 +719,164 @@ ListStatus slist_clear(SList *list) {
     list->head = NULL;
     list->tail = NULL;
     list->count = 0;
+    if (list->values) value_index_clear(list->values);
+    return LIST_OK;
+}
+
+/* Cadena con la menor cabeza; ante empate, la anterior. */
+static inline int slist_merge_best(const int *keys, int live, ListCompare cmp) {
+    int best = 0;
+
+    for (int i = 1; i < live; i++) {
+        if (!run_sort_before(keys[best], keys[i], cmp)) best = i;
+    }
+
+    return best;
+}
+
+/* Quita la cadena i de las live en mezcla; las demás conservan su orden. */
+static inline void slist_merge_drop(Node **heads, Node **lasts, int *keys, int i, int live) {
+    for (; i < live - 1; i++) {
+        heads[i] = heads[i + 1];
+        lasts[i] = lasts[i + 1];
+        keys[i] = keys[i + 1];
+    }
+}
+
+/*
+ * Mezcla estable de n cadenas ordenadas terminadas en NULL; chains[0] tiene
+ * los elementos más antiguos y gana los empates. La menor cabeza se elige con
+ * un recorrido lineal sobre keys, y al convertirse un nodo en cabeza se pide
+ * su siguiente con prefetch: mientras se consumen las otras cadenas ese
+ * nodo llega a la caché, así que hay hasta n fallos de caché en vuelo en lugar
+ * de uno. En tail se devuelve el último nodo de la mezcla.
+ */
+static Node *slist_merge(Node **chains, Node **ends, int n, ListCompare cmp, Node **tail) {
+    Node *heads[SLIST_SORT_WAYS + 1];
+    Node *lasts[SLIST_SORT_WAYS + 1];
+    int keys[SLIST_SORT_WAYS + 1];
+    int live = 0; // cadenas con nodos
+
+    for (int i = 0; i < n; i++) {
+        if (!chains[i]) continue;
+
+        heads[live] = chains[i];
+        lasts[live] = ends[i];
+        keys[live] = chains[i]->value;
+        prefetch_read(chains[i]->next);
+        live++;
+    }
+
+    Node head; // nodo auxiliar para no tratar aparte el primero
+    Node *last = &head;
+
+    while (live > 1) { // cadenas que van completas antes que las demás se enlazan sin recorrerlas
+        int best = slist_merge_best(keys, live, cmp);
+        int end_key = lasts[best]->value;
+        bool whole = true;
+
+        for (int i = 0; i < live && whole; i++) { // ante empate solo pasan las cadenas anteriores
+            if (i < best) whole = !run_sort_before(keys[i], end_key, cmp);
+            if (i > best) whole = run_sort_before(end_key, keys[i], cmp);
+        }
+
+        if (!whole) break;
+
+        last->next = heads[best];
+        last = lasts[best];
+        slist_merge_drop(heads, lasts, keys, best, live--);
+    }
+
+    while (live > 1) {
+        int best = slist_merge_best(keys, live, cmp);
+
+        Node *actual = heads[best];
+        last->next = actual;
+        last = actual;
+
+        if (actual->next) { // avanza la cadena elegida
+            heads[best] = actual->next;
+            keys[best] = heads[best]->value;
+            prefetch_read(heads[best]->next);
+        } else { // la cadena se agotó
+            slist_merge_drop(heads, lasts, keys, best, live--);
+        }
+    }
+
+    last->next = heads[0]; // lo que queda ya está ordenado
+    *tail = lasts[0];
+    return head.next;
+}
+
+/*
+ * Merge sort bottom-up en dos fases. Primero cada tramo de RUN_SORT_BLOCK
+ * nodos consecutivos se ordena en un búfer de la pila y sus valores vuelven a
+ * los mismos nodos. Después los tramos se mezclan reenlazando nodos con un
+ * contador en base SLIST_SORT_WAYS: pending[l] guarda hasta SLIST_SORT_WAYS
+ * cadenas de SLIST_SORT_WAYS^l tramos y, al llenarse, se mezclan en una sola
+ * que sube al nivel siguiente. Mezclar varias cadenas a la vez reduce las
+ * pasadas sobre los nodos, que en una lista con los nodos dispersos en memoria
+ * son las que dominan el tiempo. La memoria extra es fija.
+ */
+ListStatus slist_sort(SList *list, ListCompare cmp) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    Node *pending[SLIST_SORT_LEVELS][SLIST_SORT_WAYS + 1];
+    Node *ends[SLIST_SORT_LEVELS][SLIST_SORT_WAYS + 1]; // último nodo de cada cadena
+    int filled[SLIST_SORT_LEVELS] = {0};
+    int values[RUN_SORT_BLOCK];
+    int tmp[RUN_SORT_BLOCK];
+    Node *actual = list->head;
+    int used = 1; // niveles de pending en uso
+
+    while (actual) {
+        Node *run = actual; // primer nodo del tramo
+        Node *last = NULL;
+        size_t n = 0;
+
+        while (actual && n < RUN_SORT_BLOCK) { // copiamos el tramo
+            values[n++] = actual->value;
+            actual = actual->next;
+        }
+
+        run_sort(values, tmp, n, cmp);
+
+        Node *node = run;
+        for (size_t i = 0; i < n; i++) { // los valores vuelven ordenados a los mismos nodos
+            node->value = values[i];
+            last = node;
+            node = node->next;
+        }
+
+        last->next = NULL; // el tramo queda como cadena independiente
+        pending[0][filled[0]] = run;
+        ends[0][filled[0]++] = last;
+
+        for (int l = 0; filled[l] == SLIST_SORT_WAYS; l++) { // acarreo al nivel siguiente
+            Node *merged_end = NULL;
+            Node *merged = slist_merge(pending[l], ends[l], SLIST_SORT_WAYS, cmp, &merged_end);
+
+            filled[l] = 0;
+            pending[l + 1][filled[l + 1]] = merged;
+            ends[l + 1][filled[l + 1]++] = merged_end;
+            if (l + 2 > used) used = l + 2;
+        }
+    }
+
+    Node *sorted = NULL;
+    Node *sorted_end = NULL;
+
+    for (int l = 0; l < used; l++) { // el nivel l tiene elementos anteriores a sorted
+        if (!filled[l]) continue;
+
+        pending[l][filled[l]] = sorted;
+        ends[l][filled[l]] = sorted_end;
+        sorted = slist_merge(pending[l], ends[l], filled[l] + 1, cmp, &sorted_end);
+    }
+
+    list->head = sorted;
+    list->tail = sorted_end;
     return LIST_OK;
 }
 
@@ -305,10 +896,255 @@ ListStatus slist_sum(SList *list, int *sum) {
     return LIST_OK;
 }
 
+typedef struct ParSegment {
+    Node *first;
+    int count;
+} ParSegment;
+
+typedef struct SListPar {
+    ParSegment *segments;
+    unsigned *sums; // suma de cada tramo, sin signo para desbordarse igual que slist_sum
+} SListPar;
+
+static void slist_par_sum_task(void *ctx, size_t task) {
+    SListPar *par = ctx;
+    Node *actual = par->segments[task].first;
+    unsigned total = 0;
+
+    for (int i = par->segments[task].count; i > 0; i--) {
+        total += (unsigned)actual->value;
+        actual = actual->next;
+    }
+
+    par->sums[task] = total;
+}
+
+ListStatus slist_par_sum(SList *list, unsigned threads, int *sum) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    size_t chunks = (size_t)list->count / SLIST_PAR_MIN_CHUNK;
+    size_t wanted;
+
+    threads = par_pool_threads(threads, chunks);
+    wanted = (size_t)threads * SLIST_PAR_SPLIT;
+    if (wanted > chunks) wanted = chunks;
+
+    ParSegment *segments = threads > 1 && wanted > 1 ? malloc(wanted * sizeof(ParSegment)) : NULL;
+    unsigned *sums = segments ? malloc(wanted * sizeof(unsigned)) : NULL;
+
+    if (!segments || !sums) { // lista corta, un solo hilo o sin memoria: suma serial
+        free(segments);
+        return slist_sum(list, sum);
+    }
+
+    int size = (int)((size_t)list->count / wanted);
+    size_t k = 0;
+    Node *actual = list->head;
+
+    for (int pos = 0; actual && k < wanted; pos++, actual = actual->next) { // una pasada para partir la lista
+        if (pos % size == 0) segments[k++].first = actual;
+    }
+
+    for (size_t i = 0; i < k; i++) { // el último tramo se lleva el resto
+        segments[i].count = i + 1 < k ? size : list->count - (int)(size * (k - 1));
+    }
+
+    SListPar par = {segments, sums};
+    unsigned total = 0;
+
+    par_pool_run(threads, k, slist_par_sum_task, &par);
+
+    for (size_t i = 0; i < k; i++) {
+        total += sums[i];
+    }
+
+    free(segments);
+    free(sums);
+    *sum = (int)total;
+    return LIST_OK;
+}
+
+ListStatus slist_to_array(SList *list, int *out, size_t cap, size_t *written) {
+    if (!list) return LIST_ERR_NULL;
+    if (!written) return LIST_ERR_NULL;
+
+    *written = 0;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (!out && cap) return LIST_ERR_NULL;
+
+    Node *actual = list->head;
+    Node *ahead = list->head; // va PREFETCH_DISTANCE nodos por delante
+    size_t i = 0;
+
+    for (int d = 0; d < PREFETCH_DISTANCE && ahead; d++) {
+        ahead = ahead->next;
+    }
+
+    while (actual && i < cap) {
+        if (ahead) { // pedimos el nodo lejano antes de necesitarlo
+            ahead = ahead->next;
+            prefetch_read(ahead);
+        }
+
+        out[i++] = actual->value;
+        actual = actual->next;
+    }
+
+    *written = i;
+    return actual ? LIST_ERR_OUT_OF_RANGE : LIST_OK;
+}
+
+ListStatus slist_save(SList *list, int fd) {
+    if (!list) return LIST_ERR_NULL;
+
+    SnapshotWriter writer;
+    ListStatus status = snapshot_write_begin(&writer, fd, (uint64_t)list->count);
+    if (status != LIST_OK) return status;
+
+    Node *actual = list->head;
+    Node *ahead = list->head; // va PREFETCH_DISTANCE nodos por delante
+
+    for (int d = 0; d < PREFETCH_DISTANCE && ahead; d++) {
+        ahead = ahead->next;
+    }
+
+    while (actual && status == LIST_OK) {
+        size_t n = 0;
+
+        while (actual && n < SNAPSHOT_CHUNK) {
+            if (ahead) { // pedimos el nodo lejano antes de necesitarlo
+                ahead = ahead->next;
+                prefetch_read(ahead);
+            }
+
+            writer.values[n++] = actual->value;
+            actual = actual->next;
+        }
+
+        status = snapshot_write_chunk(&writer, n);
+    }
+
+    return snapshot_write_end(&writer, status);
+}
+
+ListStatus slist_load(int fd, SList **out) {
+    if (!out) return LIST_ERR_NULL;
+
+    SnapshotReader reader;
+    uint64_t count = 0;
+    ListStatus status = snapshot_read_begin(&reader, fd, &count);
+    if (status != LIST_OK) return snapshot_read_end(&reader, status);
+    if (count > INT_MAX) return snapshot_read_end(&reader, LIST_ERR_FORMAT);
+
+    /* Con pool cada chunk es un solo bloque de nodos contiguos: un malloc por chunk. */
+    SList *list = slist_create_pooled(count < SNAPSHOT_CHUNK ? (size_t)count : SNAPSHOT_CHUNK);
+    if (!list) return snapshot_read_end(&reader, LIST_ERR_ALLOC);
+
+    while (status == LIST_OK && (uint64_t)list->count < count) {
+        size_t n = 0;
+
+        status = snapshot_read_chunk(&reader, &n);
+        if (status == LIST_OK) status = slist_extend(list, reader.values, n);
+    }
+
+    status = snapshot_read_end(&reader, status);
+    if (status != LIST_OK) {
+        slist_destroy(list);
+        return status;
+    }
+
+    *out = list;
+    return LIST_OK;
+}
+
+ListStatus slist_aggregate(SList *list, unsigned flags, int value, ListAggregate *result) {
+    if (!list) return LIST_ERR_NULL;
+    if (!result) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    int buffer[AGGREGATE_BLOCK]; // valores reunidos durante el recorrido
+    size_t filled = 0;
+    Node *actual = list->head;
+
+    aggregate_init(result);
+
+    while (actual) {
+        buffer[filled++] = actual->value;
+        actual = actual->next;
+
+        if (filled == AGGREGATE_BLOCK) { // reducimos el búfer lleno
+            aggregate_block(buffer, filled, flags, value, result);
+            filled = 0;
+        }
+    }
+
+    aggregate_block(buffer, filled, flags, value, result); // resto del búfer
+    return LIST_OK;
+}
+
+ListStatus slist_sum64(SList *list, long long *sum) {
+    ListAggregate result;
+    ListStatus status = slist_aggregate(list, LIST_AGG_SUM, 0, &result);
+
+    if (status != LIST_OK) return status;
+
+    *sum = result.sum;
+    return LIST_OK;
+}
+
+ListStatus slist_min(SList *list, int *min) {
+    ListAggregate result;
+    ListStatus status = slist_aggregate(list, LIST_AGG_MIN, 0, &result);
+
+    if (status != LIST_OK) return status;
+
+    *min = result.min;
+    return LIST_OK;
+}
+
+ListStatus slist_max(SList *list, int *max) {
+    ListAggregate result;
+    ListStatus status = slist_aggregate(list, LIST_AGG_MAX, 0, &result);
+
+    if (status != LIST_OK) return status;
+
+    *max = result.max;
+    return LIST_OK;
+}
+
+ListStatus slist_minmax(SList *list, int *min, int *max) {
+    ListAggregate result;
+    ListStatus status = slist_aggregate(list, LIST_AGG_MIN | LIST_AGG_MAX, 0, &result);
+
+    if (status != LIST_OK) return status;
+
+    *min = result.min;
+    *max = result.max;
+    return LIST_OK;
+}
+
+ListStatus slist_count_if_equal(SList *list, int value, int *count) {
+    if (list && list->head && list->values) { // respuesta directa del índice
+        *count = value_index_count(list->values, value);
+        return LIST_OK;
+    }
+
+    ListAggregate result;
+    ListStatus status = slist_aggregate(list, LIST_AGG_COUNT_EQUAL, value, &result);
+
+    if (status != LIST_OK) return status;
+
+    *count = result.equal_count;
+    return LIST_OK;
+}
+
 ListStatus slist_destroy(SList *list) {
     if (!list) return LIST_ERR_NULL;
 
     slist_clear(list);
+    value_index_destroy(list->values);
+    node_pool_destroy(list->pool);
     free(list);
     return LIST_OK;
 }
@@ -324,4 +1160,73 @@ void slist_show(SList *list) {
     }
 
     printf("NULL");
-}
\ No newline at end of file
+}
+ListStatus slist_cursor_begin(SList *list, SListCursor *cursor) {
+    if (!list) return LIST_ERR_NULL;
+    if (!cursor) return LIST_ERR_NULL;
+
+    cursor->list = list;
+    cursor->prev = NULL;
+    cursor->node = list->head;
+    return LIST_OK;
+}
+
+ListStatus slist_cursor_next(SListCursor *cursor) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    cursor->prev = cursor->node;
+    cursor->node = ((Node *)cursor->node)->next;
+    return LIST_OK;
+}
+
+ListStatus slist_cursor_get(SListCursor *cursor, int *value) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    *value = ((Node *)cursor->node)->value;
+    return LIST_OK;
+}
+
+ListStatus slist_cursor_set(SListCursor *cursor, int value) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    slist_node_set(cursor->list, cursor->node, value);
+    return LIST_OK;
+}
+
+ListStatus slist_cursor_insert_before(SListCursor *cursor, int value) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+
+    Node *new = slist_node_alloc(cursor->list); // nuevo nodo
+    if (!new) return LIST_ERR_ALLOC;
+
+    new->value = value;
+    slist_link_after(cursor->list, cursor->prev, new);
+    cursor->prev = new; // el cursor sigue en el mismo nodo
+    return LIST_OK;
+}
+
+ListStatus slist_cursor_insert_after(SListCursor *cursor, int value) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *new = slist_node_alloc(cursor->list); // nuevo nodo
+    if (!new) return LIST_ERR_ALLOC;
+
+    new->value = value;
+    slist_link_after(cursor->list, cursor->node, new);
+    return LIST_OK;
+}
+
+ListStatus slist_cursor_erase(SListCursor *cursor) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *actual = slist_unlink_after(cursor->list, cursor->prev);
+
+    cursor->node = actual->next; // el cursor pasa al siguiente
+    slist_node_release(cursor->list, actual); // liberamos
+    return LIST_OK;
+}
@@ -0,0 +1,203 @@
+#include "slist_queue.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <limits.h>
+
+#include "epoch.h"
+
+#define SLIST_QUEUE_LINE 64 // bytes por línea de caché
+
+typedef struct Node {
+    int value;
+    struct Node *next;
+} Node;
+
+/*
+ * head es el nodo vacío y tail el último nodo (o uno cercano: un hilo puede
+ * haber enlazado después de tail sin moverlo todavía). Cada campo va en su
+ * propia línea de caché para que productores y consumidores no se
+ * estorben.
+ */
+struct SListQueue {
+    Node *head;
+    char pad_head[SLIST_QUEUE_LINE - sizeof(Node *)];
+    Node *tail;
+    char pad_tail[SLIST_QUEUE_LINE - sizeof(Node *)];
+    int count; // contador relajado de elementos
+};
+
+SListQueue *slist_queue_create(void) {
+    SListQueue *queue = malloc(sizeof(SListQueue)); // creamos la cola
+    Node *dummy = malloc(sizeof(Node)); // nodo vacío inicial
+
+    if (!queue || !dummy) {
+        free(queue);
+        free(dummy);
+        return NULL;
+    }
+
+    dummy->next = NULL;
+    queue->head = dummy;
+    queue->tail = dummy;
+    queue->count = 0;
+    return queue;
+}
+
+/* Enlaza la cadena first..last (ya enlazada entre sí) después del último nodo. */
+static void slist_queue_link(SListQueue *queue, Node *first, Node *last) {
+    for (;;) {
+        Node *tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+        Node *next = __atomic_load_n(&tail->next, __ATOMIC_ACQUIRE);
+
+        if (tail != __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE)) continue; // tail cambió
+
+        if (next) { // tail se quedó atrás: lo ayudamos a avanzar
+            __atomic_compare_exchange_n(&queue->tail, &tail, next, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+            continue;
+        }
+
+        if (__atomic_compare_exchange_n(&tail->next, &next, first, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+            // si falla, otro hilo ya movió tail
+            __atomic_compare_exchange_n(&queue->tail, &tail, last, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+            return;
+        }
+    }
+}
+
+ListStatus slist_queue_size(SListQueue *queue, int *count) {
+    if (!queue) return LIST_ERR_NULL;
+
+    *count = __atomic_load_n(&queue->count, __ATOMIC_RELAXED);
+    return LIST_OK;
+}
+
+ListStatus slist_queue_is_empty(SListQueue *queue, bool *is_empty) {
+    if (!queue) return LIST_ERR_NULL;
+    if (epoch_enter() != LIST_OK) return LIST_ERR_ALLOC;
+
+    Node *head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+
+    *is_empty = __atomic_load_n(&head->next, __ATOMIC_ACQUIRE) == NULL;
+    epoch_exit();
+    return LIST_OK;
+}
+
+ListStatus slist_queue_enqueue(SListQueue *queue, int value) {
+    if (!queue) return LIST_ERR_NULL;
+
+    Node *new = malloc(sizeof(Node)); // nuevo nodo
+    if (!new) return LIST_ERR_ALLOC;
+
+    new->value = value;
+    new->next = NULL;
+
+    if (epoch_enter() != LIST_OK) {
+        free(new);
+        return LIST_ERR_ALLOC;
+    }
+
+    slist_queue_link(queue, new, new);
+    epoch_exit();
+    __atomic_fetch_add(&queue->count, 1, __ATOMIC_RELAXED);
+    return LIST_OK;
+}
+
+ListStatus slist_queue_enqueue_many(SListQueue *queue, const int *values, size_t n) {
+    if (!queue) return LIST_ERR_NULL;
+    if (n == 0) return LIST_OK;
+    if (!values) return LIST_ERR_NULL;
+    if (n > INT_MAX) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *first = NULL;
+    Node *last = NULL;
+
+    for (size_t i = 0; i < n; i++) { // cadena privada, todavía fuera de la cola
+        Node *new = malloc(sizeof(Node));
+
+        if (!new) {
+            while (first) { // deshacemos la cadena
+                Node *next = first->next;
+                free(first);
+                first = next;
+            }
+
+            return LIST_ERR_ALLOC;
+        }
+
+        new->value = values[i];
+        new->next = NULL;
+
+        if (last) last->next = new;
+        else first = new;
+        last = new;
+    }
+
+    if (epoch_enter() != LIST_OK) {
+        while (first) {
+            Node *next = first->next;
+            free(first);
+            first = next;
+        }
+
+        return LIST_ERR_ALLOC;
+    }
+
+    slist_queue_link(queue, first, last);
+    epoch_exit();
+    __atomic_fetch_add(&queue->count, (int)n, __ATOMIC_RELAXED);
+    return LIST_OK;
+}
+
+ListStatus slist_queue_dequeue(SListQueue *queue, int *value) {
+    if (!queue) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+    if (epoch_enter() != LIST_OK) return LIST_ERR_ALLOC;
+
+    Node *head;
+
+    for (;;) {
+        head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+
+        Node *tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+        Node *next = __atomic_load_n(&head->next, __ATOMIC_ACQUIRE);
+
+        if (head != __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE)) continue; // head cambió
+
+        if (!next) { // solo queda el nodo vacío
+            epoch_exit();
+            return LIST_ERR_EMPTY;
+        }
+
+        if (head == tail) { // tail se quedó atrás: lo ayudamos a avanzar
+            __atomic_compare_exchange_n(&queue->tail, &tail, next, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+            continue;
+        }
+
+        int result = next->value; // primer elemento de la cola
+
+        if (__atomic_compare_exchange_n(&queue->head, &head, next, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+            *value = result; // next es el nuevo nodo vacío
+            break;
+        }
+    }
+
+    epoch_exit();
+    epoch_retire(head, free); // el nodo vacío anterior ya no es alcanzable
+    __atomic_fetch_sub(&queue->count, 1, __ATOMIC_RELAXED);
+    return LIST_OK;
+}
+
+ListStatus slist_queue_destroy(SListQueue *queue) {
+    if (!queue) return LIST_ERR_NULL;
+
+    Node *actual = queue->head; // incluye el nodo vacío
+
+    while (actual) {
+        Node *next = actual->next;
+        free(actual);
+        actual = next;
+    }
+
+    free(queue);
+    return LIST_OK;
+}
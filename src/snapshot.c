@@ -0,0 +1,302 @@
+#include "snapshot.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SNAPSHOT_X86 1
+#include <immintrin.h>
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define SNAPSHOT_BIG_ENDIAN 1
+#endif
+
+#define SNAPSHOT_HEADER_BYTES 24
+#define SNAPSHOT_CHUNK_HEADER 8
+#define SNAPSHOT_MAX_CHUNK (1u << 24) // límite al reservar según una cabecera ajena
+
+static const unsigned char snapshot_magic[4] = { 'L', 'N', 'K', 'L' };
+
+typedef uint32_t (*SnapshotCrc)(uint32_t crc, const unsigned char *data, size_t n);
+
+/* CRC32C (Castagnoli) por nibbles: 16 entradas, sin tablas que generar. */
+static const uint32_t snapshot_crc_nibble[16] = {
+    0x00000000, 0x105ec76f, 0x20bd8ede, 0x30e349b1, 0x417b1dbc, 0x5125dad3, 0x61c69362, 0x7198540d,
+    0x82f63b78, 0x92a8fc17, 0xa24bb5a6, 0xb21572c9, 0xc38d26c4, 0xd3d3e1ab, 0xe330a81a, 0xf36e6f75
+};
+
+static uint32_t snapshot_crc_scalar(uint32_t crc, const unsigned char *data, size_t n) {
+    crc = ~crc;
+    for (size_t i = 0; i < n; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ snapshot_crc_nibble[crc & 15];
+        crc = (crc >> 4) ^ snapshot_crc_nibble[crc & 15];
+    }
+    return ~crc;
+}
+
+#ifdef SNAPSHOT_X86
+
+/* SSE4.2 trae la instrucción crc32 con el mismo polinomio. */
+__attribute__((target("sse4.2")))
+static uint32_t snapshot_crc_sse42(uint32_t crc, const unsigned char *data, size_t n) {
+    size_t i = 0;
+
+    crc = ~crc;
+#ifdef __x86_64__
+    uint64_t wide = crc;
+
+    for (; i + 8 <= n; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, 8);
+        wide = _mm_crc32_u64(wide, word);
+    }
+    crc = (uint32_t)wide;
+#endif
+    for (; i + 4 <= n; i += 4) {
+        uint32_t word;
+        memcpy(&word, data + i, 4);
+        crc = _mm_crc32_u32(crc, word);
+    }
+    for (; i < n; i++) {
+        crc = _mm_crc32_u8(crc, data[i]);
+    }
+    return ~crc;
+}
+
+static SnapshotCrc snapshot_crc_select(void) {
+    __builtin_cpu_init(); // consulta CPUID
+
+    if (__builtin_cpu_supports("sse4.2")) return snapshot_crc_sse42;
+    return snapshot_crc_scalar;
+}
+
+static uint32_t snapshot_crc(uint32_t crc, const unsigned char *data, size_t n) {
+    static SnapshotCrc kernel = NULL; // se elige una sola vez
+
+    SnapshotCrc actual = __atomic_load_n(&kernel, __ATOMIC_RELAXED);
+
+    if (!actual) {
+        actual = snapshot_crc_select();
+        __atomic_store_n(&kernel, actual, __ATOMIC_RELAXED);
+    }
+
+    return actual(crc, data, n);
+}
+
+#else
+
+static uint32_t snapshot_crc(uint32_t crc, const unsigned char *data, size_t n) {
+    return snapshot_crc_scalar(crc, data, n);
+}
+
+#endif
+
+static void snapshot_store_u16(unsigned char *p, uint16_t v) {
+    p[0] = (unsigned char)v;
+    p[1] = (unsigned char)(v >> 8);
+}
+
+static void snapshot_store_u32(unsigned char *p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = (unsigned char)(v >> (8 * i));
+}
+
+static void snapshot_store_u64(unsigned char *p, uint64_t v) {
+    for (int i = 0; i < 8; i++) p[i] = (unsigned char)(v >> (8 * i));
+}
+
+static uint16_t snapshot_load_u16(const unsigned char *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t snapshot_load_u32(const unsigned char *p) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; i++) v |= (uint32_t)p[i] << (8 * i);
+    return v;
+}
+
+static uint64_t snapshot_load_u64(const unsigned char *p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) v |= (uint64_t)p[i] << (8 * i);
+    return v;
+}
+
+/* Los valores viajan en little endian; en hosts little endian no se tocan. */
+static void snapshot_swap_values(int *values, size_t n) {
+#ifdef SNAPSHOT_BIG_ENDIAN
+    for (size_t i = 0; i < n; i++) {
+        values[i] = (int)__builtin_bswap32((uint32_t)values[i]);
+    }
+#else
+    (void)values;
+    (void)n;
+#endif
+}
+
+static ListStatus snapshot_write_all(int fd, const unsigned char *data, size_t n) {
+    while (n > 0) {
+        ssize_t done = write(fd, data, n);
+
+        if (done < 0) {
+            if (errno == EINTR) continue;
+            return LIST_ERR_IO;
+        }
+        if (done == 0) return LIST_ERR_IO;
+
+        data += done;
+        n -= (size_t)done;
+    }
+    return LIST_OK;
+}
+
+/* Un fin de archivo antes de tiempo es un snapshot truncado, no un error de E/S. */
+static ListStatus snapshot_read_all(int fd, unsigned char *data, size_t n) {
+    while (n > 0) {
+        ssize_t done = read(fd, data, n);
+
+        if (done < 0) {
+            if (errno == EINTR) continue;
+            return LIST_ERR_IO;
+        }
+        if (done == 0) return LIST_ERR_FORMAT;
+
+        data += done;
+        n -= (size_t)done;
+    }
+    return LIST_OK;
+}
+
+static unsigned char *snapshot_buffer(uint32_t chunk) {
+    return malloc(SNAPSHOT_CHUNK_HEADER + (size_t)chunk * sizeof(int));
+}
+
+ListStatus snapshot_write_begin(SnapshotWriter *writer, int fd, uint64_t count) {
+    unsigned char header[SNAPSHOT_HEADER_BYTES];
+
+    memcpy(header, snapshot_magic, 4);
+    snapshot_store_u16(header + 4, SNAPSHOT_VERSION);
+    snapshot_store_u16(header + 6, 0);
+    snapshot_store_u64(header + 8, count);
+    snapshot_store_u32(header + 16, SNAPSHOT_CHUNK);
+    snapshot_store_u32(header + 20, snapshot_crc(0, header, 20));
+
+    writer->fd = fd;
+    writer->crc = 0;
+    writer->buffer = snapshot_buffer(SNAPSHOT_CHUNK);
+    if (!writer->buffer) return LIST_ERR_ALLOC;
+    writer->values = (int *)(writer->buffer + SNAPSHOT_CHUNK_HEADER);
+
+    ListStatus status = snapshot_write_all(fd, header, sizeof(header));
+    if (status != LIST_OK) {
+        free(writer->buffer);
+        writer->buffer = NULL;
+    }
+    return status;
+}
+
+ListStatus snapshot_write_chunk(SnapshotWriter *writer, size_t n) {
+    size_t bytes = n * sizeof(int);
+    unsigned char *payload = writer->buffer + SNAPSHOT_CHUNK_HEADER;
+
+    snapshot_swap_values(writer->values, n);
+
+    uint32_t crc = snapshot_crc(0, payload, bytes);
+    unsigned char crc_bytes[4];
+
+    snapshot_store_u32(writer->buffer, (uint32_t)n);
+    snapshot_store_u32(writer->buffer + 4, crc);
+    snapshot_store_u32(crc_bytes, crc);
+    writer->crc = snapshot_crc(writer->crc, crc_bytes, 4);
+
+    return snapshot_write_all(writer->fd, writer->buffer, SNAPSHOT_CHUNK_HEADER + bytes);
+}
+
+ListStatus snapshot_write_end(SnapshotWriter *writer, ListStatus status) {
+    if (status == LIST_OK) {
+        unsigned char trailer[SNAPSHOT_CHUNK_HEADER];
+
+        snapshot_store_u32(trailer, 0);
+        snapshot_store_u32(trailer + 4, writer->crc);
+        status = snapshot_write_all(writer->fd, trailer, sizeof(trailer));
+    }
+
+    free(writer->buffer);
+    writer->buffer = NULL;
+    writer->values = NULL;
+    return status;
+}
+
+ListStatus snapshot_read_begin(SnapshotReader *reader, int fd, uint64_t *count) {
+    unsigned char header[SNAPSHOT_HEADER_BYTES];
+
+    reader->buffer = NULL;
+    reader->values = NULL;
+
+    ListStatus status = snapshot_read_all(fd, header, sizeof(header));
+    if (status != LIST_OK) return status;
+
+    if (memcmp(header, snapshot_magic, 4) != 0) return LIST_ERR_FORMAT;
+    if (snapshot_load_u32(header + 20) != snapshot_crc(0, header, 20)) return LIST_ERR_FORMAT;
+    if (snapshot_load_u16(header + 4) != SNAPSHOT_VERSION) return LIST_ERR_FORMAT;
+
+    uint32_t chunk = snapshot_load_u32(header + 16);
+    if (chunk == 0 || chunk > SNAPSHOT_MAX_CHUNK) return LIST_ERR_FORMAT;
+
+    reader->fd = fd;
+    reader->chunk = chunk;
+    reader->remaining = snapshot_load_u64(header + 8);
+    reader->crc = 0;
+
+    /* Para listas cortas basta un búfer del tamaño de la lista. */
+    uint32_t capacity = reader->remaining < chunk ? (uint32_t)reader->remaining : chunk;
+
+    reader->buffer = snapshot_buffer(capacity);
+    if (!reader->buffer) return LIST_ERR_ALLOC;
+    reader->values = (int *)(reader->buffer + SNAPSHOT_CHUNK_HEADER);
+
+    *count = reader->remaining;
+    return LIST_OK;
+}
+
+ListStatus snapshot_read_chunk(SnapshotReader *reader, size_t *n) {
+    size_t expected = reader->remaining < reader->chunk ? (size_t)reader->remaining : reader->chunk;
+    size_t bytes = expected * sizeof(int);
+
+    *n = 0;
+    if (expected == 0) return LIST_ERR_OUT_OF_RANGE;
+
+    ListStatus status = snapshot_read_all(reader->fd, reader->buffer, SNAPSHOT_CHUNK_HEADER + bytes);
+    if (status != LIST_OK) return status;
+
+    unsigned char *payload = reader->buffer + SNAPSHOT_CHUNK_HEADER;
+    uint32_t crc = snapshot_crc(0, payload, bytes);
+
+    if (snapshot_load_u32(reader->buffer) != expected) return LIST_ERR_FORMAT;
+    if (snapshot_load_u32(reader->buffer + 4) != crc) return LIST_ERR_FORMAT;
+
+    reader->crc = snapshot_crc(reader->crc, reader->buffer + 4, 4);
+    reader->remaining -= expected;
+    snapshot_swap_values(reader->values, expected);
+
+    *n = expected;
+    return LIST_OK;
+}
+
+ListStatus snapshot_read_end(SnapshotReader *reader, ListStatus status) {
+    if (status == LIST_OK) {
+        unsigned char trailer[SNAPSHOT_CHUNK_HEADER];
+
+        status = snapshot_read_all(reader->fd, trailer, sizeof(trailer));
+        if (status == LIST_OK && (snapshot_load_u32(trailer) != 0 ||
+                                  snapshot_load_u32(trailer + 4) != reader->crc)) {
+            status = LIST_ERR_FORMAT;
+        }
+    }
+
+    free(reader->buffer);
+    reader->buffer = NULL;
+    reader->values = NULL;
+    return status;
+}
@@ -0,0 +1,73 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "list_status.h"
+
+/*
+ * Formato binario de *_save / *_load, compartido por SList y DList:
+ *
+ *   cabecera (24 bytes): "LNKL", versión u16, reservado u16, elementos u64,
+ *                        valores por chunk u32, CRC32C de los 20 bytes anteriores
+ *   chunks:              valores u32, CRC32C del contenido u32, valores int32
+ *   cierre (8 bytes):    0 u32, CRC32C de los CRC de todos los chunks u32
+ *
+ * Todos los campos van en little endian. Cada chunk lleva SNAPSHOT_CHUNK
+ * valores salvo el último, así el lector sabe cuántos bytes pedir y lee cada
+ * chunk con una sola llamada a read.
+ */
+
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_CHUNK 65536 // valores por chunk (256 KiB)
+
+typedef struct {
+    int fd;
+    unsigned char *buffer; // cabecera del chunk seguida de los valores
+    int *values; // SNAPSHOT_CHUNK valores que llena la lista
+    uint32_t crc; // CRC32C de los CRC de los chunks escritos
+} SnapshotWriter;
+
+typedef struct {
+    int fd;
+    unsigned char *buffer;
+    int *values; // valores del último chunk leído
+    uint32_t chunk; // valores por chunk según la cabecera
+    uint64_t remaining; // valores que faltan por leer
+    uint32_t crc;
+} SnapshotReader;
+
+/**
+ * @brief Escribe la cabecera y prepara el búfer del escritor.
+ */
+ListStatus snapshot_write_begin(SnapshotWriter *writer, int fd, uint64_t count);
+
+/**
+ * @brief Escribe un chunk con los primeros n valores de writer->values.
+ */
+ListStatus snapshot_write_chunk(SnapshotWriter *writer, size_t n);
+
+/**
+ * @brief Escribe el cierre si status es LIST_OK y libera el búfer.
+ *
+ * @return status, o el error de escritura del cierre
+ */
+ListStatus snapshot_write_end(SnapshotWriter *writer, ListStatus status);
+
+/**
+ * @brief Lee y valida la cabecera; count recibe el número de elementos.
+ */
+ListStatus snapshot_read_begin(SnapshotReader *reader, int fd, uint64_t *count);
+
+/**
+ * @brief Lee el siguiente chunk en reader->values y valida su CRC.
+ */
+ListStatus snapshot_read_chunk(SnapshotReader *reader, size_t *n);
+
+/**
+ * @brief Lee y valida el cierre si status es LIST_OK y libera el búfer.
+ */
+ListStatus snapshot_read_end(SnapshotReader *reader, ListStatus status);
+
+#endif /* SNAPSHOT_H */
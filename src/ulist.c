@@ -0,0 +1,376 @@
+#include "ulist.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#define ULIST_NODE_BYTES 64 // una línea de caché por nodo
+#define ULIST_NODE_CAPACITY ((ULIST_NODE_BYTES - sizeof(void *) - sizeof(int)) / sizeof(int))
+
+typedef struct Node {
+    struct Node *next;
+    int count; // elementos ocupados en values
+    int values[ULIST_NODE_CAPACITY];
+} Node;
+
+_Static_assert(sizeof(Node) == ULIST_NODE_BYTES, "un nodo debe ocupar exactamente una línea de caché");
+
+struct UList {
+    Node *head;
+    Node *tail;
+    int count; // número total de elementos
+    int nodes; // número de nodos reservados
+};
+
+UList *ulist_create(void) {
+    UList *list = malloc(sizeof(UList)); // creamos la lista
+
+    if (!list) return NULL;
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+    list->nodes = 0;
+    return list;
+}
+
+static Node *ulist_node_create(UList *list) {
+    Node *node = aligned_alloc(ULIST_NODE_BYTES, sizeof(Node)); // nuevo nodo, alineado a su línea de caché
+
+    if (!node) return NULL;
+
+    node->next = NULL;
+    node->count = 0;
+    list->nodes++;
+    return node;
+}
+
+static void ulist_node_free(UList *list, Node *node) {
+    free(node);
+    list->nodes--;
+}
+
+/*
+ * Busca el nodo que contiene la posición pos (1-based). En index se devuelve
+ * el índice dentro del nodo y en before el nodo anterior (NULL si es head).
+ */
+static Node *ulist_locate(UList *list, int pos, int *index, Node **before) {
+    Node *actual = list->head;
+    Node *prev = NULL;
+    int skipped = 0; // elementos en los nodos ya recorridos
+
+    while (actual && skipped + actual->count < pos) { // saltamos nodos completos
+        skipped += actual->count;
+        prev = actual;
+        actual = actual->next;
+    }
+
+    *index = pos - skipped - 1;
+    if (before) *before = prev;
+    return actual;
+}
+
+static ListStatus ulist_validate_position(UList *list, int pos, int cond) {
+    if (cond == 0) {
+        if (pos > list->count + 1 || pos < 1) return LIST_ERR_OUT_OF_RANGE;
+    } else {
+        if (pos > list->count || pos < 1) return LIST_ERR_OUT_OF_RANGE;
+    }
+
+    return LIST_OK;
+}
+
+ListStatus ulist_size(UList *list, int *count) {
+    if (!list) return LIST_ERR_NULL;
+
+    *count = list->count;
+    return LIST_OK;
+}
+
+ListStatus ulist_size_bytes(UList *list, size_t *bytes) {
+    if (!list) return LIST_ERR_NULL;
+    if (!bytes) return LIST_ERR_NULL;
+
+    *bytes = sizeof(UList) + (size_t)list->nodes * sizeof(Node); // tamaño de UList + tamaño de todos los Node
+    return LIST_OK;
+}
+
+ListStatus ulist_is_empty(UList *list, bool *is_empty) {
+    if (!list) return LIST_ERR_NULL;
+
+    *is_empty = (list->head == NULL);
+    return LIST_OK;
+}
+
+ListStatus ulist_contains(UList *list, int value, bool *found) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    Node *actual = list->head;
+
+    while (actual) { // recorremos nodo por nodo
+        for (int i = 0; i < actual->count; i++) {
+            if (actual->values[i] == value) { // se encuentra
+                *found = true;
+                return LIST_OK;
+            }
+        }
+
+        actual = actual->next;
+    }
+
+    *found = false;
+    return LIST_OK;
+}
+
+ListStatus ulist_push_back(UList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+
+    Node *tail = list->tail;
+
+    if (!tail || tail->count == (int)ULIST_NODE_CAPACITY) { // no hay espacio en tail
+        Node *new = ulist_node_create(list);
+        if (!new) return LIST_ERR_ALLOC;
+
+        if (!list->head) { // lista vacía
+            list->head = new;
+        } else {
+            tail->next = new;
+        }
+
+        list->tail = new;
+        tail = new;
+    }
+
+    tail->values[tail->count++] = value;
+    list->count++;
+    return LIST_OK;
+}
+
+ListStatus ulist_push_front(UList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+
+    Node *head = list->head;
+
+    if (!head || head->count == (int)ULIST_NODE_CAPACITY) { // no hay espacio en head
+        Node *new = ulist_node_create(list);
+        if (!new) return LIST_ERR_ALLOC;
+
+        new->next = head;
+        list->head = new;
+        if (!list->tail) list->tail = new; // lista vacía
+        head = new;
+    }
+
+    memmove(head->values + 1, head->values, head->count * sizeof(int)); // recorremos a la derecha
+    head->values[0] = value;
+    head->count++;
+    list->count++;
+    return LIST_OK;
+}
+
+ListStatus ulist_insert_in_position(UList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (ulist_validate_position(list, pos, 0) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    if (pos == 1) { // insertar al inicio
+        return ulist_push_front(list, value);
+    }
+
+    if (pos == list->count + 1) { // insertar al final
+        return ulist_push_back(list, value);
+    }
+
+    // cualquiera entre head y tail
+    int index = 0;
+    Node *actual = ulist_locate(list, pos, &index, NULL);
+
+    if (actual->count == (int)ULIST_NODE_CAPACITY) { // nodo lleno, lo dividimos
+        Node *new = ulist_node_create(list);
+        if (!new) return LIST_ERR_ALLOC;
+
+        int half = actual->count / 2;
+
+        memcpy(new->values, actual->values + half, (actual->count - half) * sizeof(int));
+        new->count = actual->count - half;
+        actual->count = half;
+
+        new->next = actual->next; // enlazamos el nuevo nodo
+        actual->next = new;
+        if (list->tail == actual) list->tail = new;
+
+        if (index >= half) { // la posición quedó en el nuevo nodo
+            index -= half;
+            actual = new;
+        }
+    }
+
+    memmove(actual->values + index + 1, actual->values + index, (actual->count - index) * sizeof(int));
+    actual->values[index] = value;
+    actual->count++;
+    list->count++;
+    return LIST_OK;
+}
+
+ListStatus ulist_change_value(UList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (ulist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    int index = 0;
+    Node *actual = ulist_locate(list, pos, &index, NULL);
+
+    actual->values[index] = value;
+    return LIST_OK;
+}
+
+ListStatus ulist_search_for_value(UList *list, int value, int *pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    Node *actual = list->head;
+    int pos_local = 0;
+
+    while (actual) { // recorremos nodo por nodo
+        for (int i = 0; i < actual->count; i++) {
+            if (actual->values[i] == value) { // se encuentra
+                *pos = pos_local + i;
+                return LIST_OK;
+            }
+        }
+
+        pos_local += actual->count;
+        actual = actual->next;
+    }
+
+    return LIST_ERR_NOT_FOUND;
+}
+
+ListStatus ulist_search_for_position(UList *list, int pos, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (ulist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    int index = 0;
+    Node *actual = ulist_locate(list, pos, &index, NULL);
+
+    *value = actual->values[index];
+    return LIST_OK;
+}
+
+ListStatus ulist_front(UList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    *value = list->head->values[0];
+    return LIST_OK;
+}
+
+ListStatus ulist_back(UList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->tail) return LIST_ERR_EMPTY;
+
+    *value = list->tail->values[list->tail->count - 1];
+    return LIST_OK;
+}
+
+ListStatus ulist_free_in_position(UList *list, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (ulist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    int index = 0;
+    Node *before = NULL;
+    Node *actual = ulist_locate(list, pos, &index, &before);
+
+    memmove(actual->values + index, actual->values + index + 1, (actual->count - index - 1) * sizeof(int));
+    actual->count--;
+    list->count--;
+
+    if (actual->count == 0) { // el nodo quedó vacío
+        if (before) before->next = actual->next;
+        else list->head = actual->next;
+
+        if (list->tail == actual) list->tail = before;
+        ulist_node_free(list, actual);
+        return LIST_OK;
+    }
+
+    Node *next = actual->next;
+
+    // fusionamos con el siguiente si el nodo quedó a menos de la mitad
+    if (next && actual->count < (int)ULIST_NODE_CAPACITY / 2 &&
+        actual->count + next->count <= (int)ULIST_NODE_CAPACITY) {
+        memcpy(actual->values + actual->count, next->values, next->count * sizeof(int));
+        actual->count += next->count;
+        actual->next = next->next;
+
+        if (list->tail == next) list->tail = actual;
+        ulist_node_free(list, next);
+    }
+
+    return LIST_OK;
+}
+
+ListStatus ulist_clear(UList *list) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    Node *actual = list->head;
+    Node *next = NULL;
+
+    while (actual) {
+        next = actual->next; // nodo siguiente
+        free(actual); // liberamos nodo actual
+        actual = next;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+    list->nodes = 0;
+    return LIST_OK;
+}
+
+ListStatus ulist_sum(UList *list, int *sum) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    Node *actual = list->head;
+    int total = 0;
+
+    while (actual) {
+        for (int i = 0; i < actual->count; i++) {
+            total += actual->values[i];
+        }
+
+        actual = actual->next;
+    }
+
+    *sum = total;
+    return LIST_OK;
+}
+
+ListStatus ulist_destroy(UList *list) {
+    if (!list) return LIST_ERR_NULL;
+
+    ulist_clear(list);
+    free(list);
+    return LIST_OK;
+}
+
+void ulist_show(UList *list) {
+    Node *actual = list->head;
+
+    printf("\n\nElementos de la lista: ");
+
+    while (actual) {
+        printf("[ ");
+        for (int i = 0; i < actual->count; i++) {
+            printf("%d ", actual->values[i]);
+        }
+        printf("] -> ");
+        actual = actual->next;
+    }
+
+    printf("NULL");
+}
@@ -0,0 +1,142 @@
+#include "value_index.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define VALUE_INDEX_MIN_CAPACITY 16
+#define VALUE_INDEX_MIN_LOG2 4 // log2 de VALUE_INDEX_MIN_CAPACITY
+
+/*
+ * Hash multiplicativo de Fibonacci. Se usan los bits altos del producto:
+ * los bajos solo dependen de los bits bajos del valor, así que valores
+ * alineados o con paso fijo (identificadores) caerían en las mismas ranuras.
+ */
+static size_t value_index_slot(const ValueIndex *index, int value) {
+    uint32_t hash = (uint32_t)value * 2654435769u;
+    return (size_t)(hash >> (32 - index->log2_capacity));
+}
+
+static bool value_index_resize(ValueIndex *index, size_t capacity) {
+    ValueSlot *slots = calloc(capacity, sizeof(ValueSlot));
+
+    if (!slots) return false;
+
+    ValueSlot *old = index->slots;
+    size_t old_capacity = index->capacity;
+
+    index->slots = slots;
+    index->capacity = capacity;
+    index->log2_capacity = 0;
+    while (((size_t)1 << index->log2_capacity) < capacity) index->log2_capacity++;
+
+    for (size_t i = 0; i < old_capacity; i++) { // reinsertamos las ranuras ocupadas
+        if (!old[i].count) continue;
+
+        size_t slot = value_index_slot(index, old[i].value);
+        while (slots[slot].count) slot = (slot + 1) & (capacity - 1);
+        slots[slot] = old[i];
+    }
+
+    free(old);
+    return true;
+}
+
+ValueIndex *value_index_create(void) {
+    ValueIndex *index = malloc(sizeof(ValueIndex));
+
+    if (!index) return NULL;
+
+    index->slots = calloc(VALUE_INDEX_MIN_CAPACITY, sizeof(ValueSlot));
+    if (!index->slots) {
+        free(index);
+        return NULL;
+    }
+
+    index->capacity = VALUE_INDEX_MIN_CAPACITY;
+    index->log2_capacity = VALUE_INDEX_MIN_LOG2;
+    index->used = 0;
+    return index;
+}
+
+bool value_index_add(ValueIndex *index, int value) {
+    size_t slot = value_index_slot(index, value);
+
+    while (index->slots[slot].count) {
+        if (index->slots[slot].value == value) { // ya existe
+            index->slots[slot].count++;
+            return true;
+        }
+
+        slot = (slot + 1) & (index->capacity - 1);
+    }
+
+    if ((index->used + 1) * 2 > index->capacity) { // factor de carga máximo 1/2
+        if (!value_index_resize(index, index->capacity * 2)) return false;
+
+        slot = value_index_slot(index, value);
+        while (index->slots[slot].count) slot = (slot + 1) & (index->capacity - 1);
+    }
+
+    index->slots[slot].value = value;
+    index->slots[slot].count = 1;
+    index->used++;
+    return true;
+}
+
+void value_index_remove(ValueIndex *index, int value) {
+    size_t mask = index->capacity - 1;
+    size_t slot = value_index_slot(index, value);
+
+    while (index->slots[slot].count && index->slots[slot].value != value) {
+        slot = (slot + 1) & mask;
+    }
+
+    if (!index->slots[slot].count) return; // no estaba registrado
+    if (--index->slots[slot].count) return; // quedan apariciones
+
+    // borrado con desplazamiento hacia atrás: no se necesitan lápidas
+    size_t hole = slot;
+    size_t next = (hole + 1) & mask;
+
+    while (index->slots[next].count) {
+        size_t home = value_index_slot(index, index->slots[next].value);
+
+        // la ranura next puede ocupar el hueco si su posición ideal no está entre hole y next
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            index->slots[hole] = index->slots[next];
+            hole = next;
+        }
+
+        next = (next + 1) & mask;
+    }
+
+    index->slots[hole].count = 0;
+    index->used--;
+}
+
+int value_index_count(const ValueIndex *index, int value) {
+    size_t slot = value_index_slot(index, value);
+
+    while (index->slots[slot].count) {
+        if (index->slots[slot].value == value) return index->slots[slot].count;
+        slot = (slot + 1) & (index->capacity - 1);
+    }
+
+    return 0;
+}
+
+void value_index_clear(ValueIndex *index) {
+    memset(index->slots, 0, index->capacity * sizeof(ValueSlot));
+    index->used = 0;
+}
+
+size_t value_index_bytes(const ValueIndex *index) {
+    return sizeof(ValueIndex) + index->capacity * sizeof(ValueSlot);
+}
+
+void value_index_destroy(ValueIndex *index) {
+    if (!index) return;
+
+    free(index->slots);
+    free(index);
+}
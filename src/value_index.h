@@ -0,0 +1,68 @@
+#ifndef VALUE_INDEX_H
+#define VALUE_INDEX_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * Índice hash interno de direccionamiento abierto (sondeo lineal) que cuenta
+ * cuántas veces aparece cada valor en una lista. Lo usan slist.c y dlist.c
+ * para responder contains y descartar search_for_value en O(1) esperado.
+ */
+
+typedef struct ValueSlot {
+    int value;
+    int count; // 0 si la ranura está libre
+} ValueSlot;
+
+typedef struct ValueIndex {
+    ValueSlot *slots;
+    size_t capacity; // siempre potencia de 2
+    unsigned log2_capacity; // capacity == 1 << log2_capacity
+    size_t used; // ranuras ocupadas
+} ValueIndex;
+
+/**
+ * @brief Crea un índice vacío.
+ *
+ * @return
+ * - Puntero al índice
+ * - NULL si falla malloc
+ */
+ValueIndex *value_index_create(void);
+
+/**
+ * @brief Suma una aparición de value.
+ *
+ * @return
+ * - true si se registró
+ * - false si falla malloc al crecer (el índice queda sin cambios)
+ */
+bool value_index_add(ValueIndex *index, int value);
+
+/**
+ * @brief Resta una aparición de value (debe estar registrado).
+ */
+void value_index_remove(ValueIndex *index, int value);
+
+/**
+ * @brief Devuelve cuántas veces aparece value.
+ */
+int value_index_count(const ValueIndex *index, int value);
+
+/**
+ * @brief Olvida todos los valores sin liberar las ranuras.
+ */
+void value_index_clear(ValueIndex *index);
+
+/**
+ * @brief Devuelve los bytes que ocupa el índice.
+ */
+size_t value_index_bytes(const ValueIndex *index);
+
+/**
+ * @brief Libera el índice.
+ */
+void value_index_destroy(ValueIndex *index);
+
+#endif /* VALUE_INDEX_H */
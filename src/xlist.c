@@ -0,0 +1,545 @@
+#include "xlist.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+
+#include "node_pool.h"
+
+/*
+ * Nodo con un solo enlace: link = dirección del anterior XOR dirección del
+ * siguiente (NULL cuenta como 0). Conociendo uno de los vecinos se obtiene el
+ * otro, así que la lista se recorre en ambos sentidos partiendo de head o de
+ * tail. El nodo ocupa 16 bytes; los nodos salen de un pool para que tampoco
+ * paguen la cabecera de malloc.
+ */
+typedef struct Node {
+    int value;
+    uintptr_t link;
+} Node;
+
+struct XList {
+    Node *head;
+    Node *tail;
+    int count;
+    NodePool *pool; // todos los nodos de la lista
+    Node *finger; // último nodo accedido por posición (NULL si no hay)
+    Node *finger_prev; // vecino del dedo hacia head
+    int finger_pos;
+};
+
+/* Vecino de node que no es neighbor. */
+static inline Node *xlist_other(const Node *node, const Node *neighbor) {
+    return (Node *)(node->link ^ (uintptr_t)neighbor);
+}
+
+XList *xlist_create(void) {
+    XList *list = malloc(sizeof(XList)); // creamos la lista
+
+    if (!list) return NULL;
+
+    list->pool = node_pool_create(sizeof(Node), 0);
+    if (!list->pool) {
+        free(list);
+        return NULL;
+    }
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+    list->finger = NULL;
+    list->finger_prev = NULL;
+    list->finger_pos = 0;
+    return list;
+}
+
+static Node *xlist_node_alloc(XList *list, int value) {
+    Node *new = node_pool_alloc(list->pool);
+
+    if (new) new->value = value;
+    return new;
+}
+
+/* Enlaza new entre los nodos vecinos before y after (cualquiera puede ser NULL). */
+static void xlist_link(XList *list, Node *before, Node *after, Node *new, int pos) {
+    new->link = (uintptr_t)before ^ (uintptr_t)after;
+
+    if (before) before->link ^= (uintptr_t)after ^ (uintptr_t)new;
+    else list->head = new;
+
+    if (after) after->link ^= (uintptr_t)before ^ (uintptr_t)new;
+    else list->tail = new;
+
+    list->count++;
+
+    if (list->finger) { // el dedo sigue siendo válido si se corrige su vecino
+        if (list->finger == after) list->finger_prev = new;
+        if (list->finger_pos >= pos) list->finger_pos++;
+    }
+}
+
+/* Desenlaza node, que está entre before y after, sin liberarlo. */
+static void xlist_unlink(XList *list, Node *before, Node *node, Node *after, int pos) {
+    if (before) before->link ^= (uintptr_t)node ^ (uintptr_t)after;
+    else list->head = after;
+
+    if (after) after->link ^= (uintptr_t)node ^ (uintptr_t)before;
+    else list->tail = before;
+
+    list->count--;
+
+    if (list->finger == node) {
+        list->finger = NULL;
+    } else if (list->finger) {
+        if (list->finger_prev == node) list->finger_prev = before;
+        if (list->finger_pos > pos) list->finger_pos--;
+    }
+}
+
+static ListStatus xlist_validate_position(XList *list, int pos, int cond) {
+    if (cond == 0) {
+        if (pos > list->count + 1 || pos < 1) return LIST_ERR_OUT_OF_RANGE;
+    } else {
+        if (pos > list->count || pos < 1) return LIST_ERR_OUT_OF_RANGE;
+    }
+
+    return LIST_OK;
+}
+
+/*
+ * Devuelve el nodo en la posición pos (ya validada) y en prev su vecino hacia
+ * head. Parte de head, de tail o del dedo, lo que esté más cerca, y deja el
+ * dedo en el nodo encontrado.
+ */
+static Node *xlist_node_at(XList *list, int pos, Node **prev) {
+    Node *before = NULL; // vecino de actual hacia head
+    Node *actual = list->head;
+    int actual_pos = 1;
+    int distance = pos - 1; // distancia desde head
+
+    if (list->count - pos < distance) { // tail está más cerca
+        actual = list->tail;
+        before = xlist_other(actual, NULL);
+        actual_pos = list->count;
+        distance = list->count - pos;
+    }
+
+    if (list->finger && abs(pos - list->finger_pos) < distance) { // el dedo está más cerca
+        actual = list->finger;
+        before = list->finger_prev;
+        actual_pos = list->finger_pos;
+    }
+
+    while (actual_pos < pos) { // avanzar hacia tail
+        Node *next = xlist_other(actual, before);
+        before = actual;
+        actual = next;
+        actual_pos++;
+    }
+
+    while (actual_pos > pos) { // retroceder hacia head
+        Node *after = actual;
+        actual = before;
+        before = xlist_other(actual, after);
+        actual_pos--;
+    }
+
+    list->finger = actual;
+    list->finger_prev = before;
+    list->finger_pos = pos;
+    *prev = before;
+    return actual;
+}
+
+ListStatus xlist_size(XList *list, int *count) {
+    if (!list) return LIST_ERR_NULL;
+
+    *count = list->count;
+    return LIST_OK;
+}
+
+ListStatus xlist_size_bytes(XList *list, size_t *bytes) {
+    if (!list) return LIST_ERR_NULL;
+    if (!bytes) return LIST_ERR_NULL;
+
+    *bytes = sizeof(XList) + node_pool_bytes(list->pool); // tamaño de XList + slabs del pool
+    return LIST_OK;
+}
+
+ListStatus xlist_is_empty(XList *list, bool *is_empty) {
+    if (!list) return LIST_ERR_NULL;
+
+    *is_empty = (list->head == NULL);
+    return LIST_OK;
+}
+
+ListStatus xlist_contains(XList *list, int value, bool *found) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    Node *before = NULL;
+    Node *actual = list->head;
+
+    while (actual) {
+        if (actual->value == value) { // se encuentra
+            *found = true;
+            return LIST_OK;
+        }
+
+        Node *next = xlist_other(actual, before);
+        before = actual;
+        actual = next;
+    }
+
+    *found = false;
+    return LIST_OK;
+}
+
+ListStatus xlist_push_back(XList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+    if (list->count == INT_MAX) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *new = xlist_node_alloc(list, value); // nuevo nodo
+    if (!new) return LIST_ERR_ALLOC;
+
+    xlist_link(list, list->tail, NULL, new, list->count + 1); // enlazamos después de tail
+    return LIST_OK;
+}
+
+ListStatus xlist_push_front(XList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+    if (list->count == INT_MAX) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *new = xlist_node_alloc(list, value); // nuevo nodo
+    if (!new) return LIST_ERR_ALLOC;
+
+    xlist_link(list, NULL, list->head, new, 1); // enlazamos como head
+    return LIST_OK;
+}
+
+ListStatus xlist_insert_in_position(XList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (xlist_validate_position(list, pos, 0) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    if (pos == 1) { // insertar al inicio
+        return xlist_push_front(list, value);
+    }
+
+    if (pos == list->count + 1) { // insertar al final
+        return xlist_push_back(list, value);
+    }
+
+    // cualquiera entre head y tail
+    Node *new = xlist_node_alloc(list, value); // número a insertar
+    if (!new) return LIST_ERR_ALLOC;
+
+    Node *before = NULL;
+    Node *after_new = xlist_node_at(list, pos, &before); // nodo que ocupa pos
+
+    xlist_link(list, before, after_new, new, pos);
+    list->finger = new; // new ocupa ahora pos
+    list->finger_prev = before;
+    list->finger_pos = pos;
+    return LIST_OK;
+}
+
+ListStatus xlist_change_value(XList *list, int value, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (xlist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *before = NULL;
+
+    xlist_node_at(list, pos, &before)->value = value;
+    return LIST_OK;
+}
+
+ListStatus xlist_search_for_value(XList *list, int value, int *pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    Node *before = NULL;
+    Node *actual = list->head;
+    int pos_local = 0;
+
+    while (actual) {
+        if (actual->value == value) { // se encuentra
+            *pos = pos_local;
+            return LIST_OK;
+        }
+
+        Node *next = xlist_other(actual, before);
+        before = actual;
+        actual = next;
+        pos_local++;
+    }
+
+    return LIST_ERR_NOT_FOUND;
+}
+
+ListStatus xlist_search_for_position(XList *list, int pos, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (xlist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *before = NULL;
+
+    *value = xlist_node_at(list, pos, &before)->value;
+    return LIST_OK;
+}
+
+ListStatus xlist_front(XList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    *value = list->head->value;
+    return LIST_OK;
+}
+
+ListStatus xlist_back(XList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->tail) return LIST_ERR_EMPTY;
+
+    *value = list->tail->value;
+    return LIST_OK;
+}
+
+ListStatus xlist_free_in_position(XList *list, int pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (xlist_validate_position(list, pos, 1) != LIST_OK) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *before = NULL;
+    Node *actual = xlist_node_at(list, pos, &before); // nodo a liberar
+    Node *after = xlist_other(actual, before);
+
+    xlist_unlink(list, before, actual, after, pos);
+    node_pool_release(list->pool, actual); // liberamos
+    return LIST_OK;
+}
+
+ListStatus xlist_pop_front(XList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    Node *actual = list->head; // nodo a liberar
+
+    *value = actual->value;
+    xlist_unlink(list, NULL, actual, xlist_other(actual, NULL), 1);
+    node_pool_release(list->pool, actual); // liberamos
+    return LIST_OK;
+}
+
+ListStatus xlist_pop_back(XList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!value) return LIST_ERR_NULL;
+    if (!list->tail) return LIST_ERR_EMPTY;
+
+    Node *actual = list->tail; // nodo a liberar, sin recorrer desde head
+
+    *value = actual->value;
+    xlist_unlink(list, xlist_other(actual, NULL), actual, NULL, list->count);
+    node_pool_release(list->pool, actual); // liberamos
+    return LIST_OK;
+}
+
+ListStatus xlist_clear(XList *list) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    node_pool_reset(list->pool); // liberamos los slabs completos
+    list->head = NULL;
+    list->tail = NULL;
+    list->count = 0;
+    list->finger = NULL;
+    list->finger_prev = NULL;
+    list->finger_pos = 0;
+    return LIST_OK;
+}
+
+ListStatus xlist_sum(XList *list, int *sum) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->head) return LIST_ERR_EMPTY;
+
+    Node *before = NULL;
+    Node *actual = list->head;
+    int total = 0;
+
+    while (actual) {
+        total += actual->value;
+
+        Node *next = xlist_other(actual, before);
+        before = actual;
+        actual = next;
+    }
+
+    *sum = total;
+    return LIST_OK;
+}
+
+/*
+ * Copia la lista en out desde head (reverse == false) o desde tail. El
+ * recorrido es el mismo en ambos sentidos: solo cambia el extremo de partida.
+ */
+static ListStatus xlist_copy_out(XList *list, int *out, size_t cap, size_t *written, bool reverse) {
+    if (!list) return LIST_ERR_NULL;
+    if (!written) return LIST_ERR_NULL;
+
+    *written = 0;
+    if (!list->head) return LIST_ERR_EMPTY;
+    if (!out && cap) return LIST_ERR_NULL;
+
+    Node *before = NULL;
+    Node *actual = reverse ? list->tail : list->head;
+    size_t i = 0;
+
+    while (actual && i < cap) {
+        Node *next = xlist_other(actual, before);
+
+        out[i++] = actual->value;
+        before = actual;
+        actual = next;
+    }
+
+    *written = i;
+    return actual ? LIST_ERR_OUT_OF_RANGE : LIST_OK;
+}
+
+ListStatus xlist_to_array(XList *list, int *out, size_t cap, size_t *written) {
+    return xlist_copy_out(list, out, cap, written, false);
+}
+
+ListStatus xlist_to_array_reverse(XList *list, int *out, size_t cap, size_t *written) {
+    return xlist_copy_out(list, out, cap, written, true);
+}
+
+ListStatus xlist_destroy(XList *list) {
+    if (!list) return LIST_ERR_NULL;
+
+    node_pool_destroy(list->pool);
+    free(list);
+    return LIST_OK;
+}
+
+void xlist_show(XList *list) {
+    Node *before = NULL;
+    Node *actual = list->head;
+
+    printf("\n\nElementos de la lista: ");
+    printf("NULL <-> ");
+    while (actual) {
+        printf("%d <-> ", actual->value);
+
+        Node *next = xlist_other(actual, before);
+        before = actual;
+        actual = next;
+    }
+
+    printf("NULL");
+
+    before = NULL;
+    actual = list->tail;
+
+    printf("NULL <-> ");
+    while (actual) {
+        printf("%d <-> ", actual->value);
+
+        Node *next = xlist_other(actual, before);
+        before = actual;
+        actual = next;
+    }
+
+    printf("NULL");
+}
+
+ListStatus xlist_cursor_begin(XList *list, XListCursor *cursor) {
+    if (!list) return LIST_ERR_NULL;
+    if (!cursor) return LIST_ERR_NULL;
+
+    cursor->list = list;
+    cursor->prev = NULL;
+    cursor->node = list->head;
+    cursor->pos = 1;
+    return LIST_OK;
+}
+
+ListStatus xlist_cursor_next(XListCursor *cursor) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *next = xlist_other(cursor->node, cursor->prev);
+
+    cursor->prev = cursor->node;
+    cursor->node = next;
+    cursor->pos++;
+    return LIST_OK;
+}
+
+ListStatus xlist_cursor_prev(XListCursor *cursor) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->prev) return LIST_ERR_OUT_OF_RANGE; // ya estaba en el primero
+
+    Node *actual = cursor->prev;
+
+    cursor->prev = xlist_other(actual, cursor->node);
+    cursor->node = actual;
+    cursor->pos--;
+    return LIST_OK;
+}
+
+ListStatus xlist_cursor_get(XListCursor *cursor, int *value) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    *value = ((Node *)cursor->node)->value;
+    return LIST_OK;
+}
+
+ListStatus xlist_cursor_set(XListCursor *cursor, int value) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    ((Node *)cursor->node)->value = value;
+    return LIST_OK;
+}
+
+ListStatus xlist_cursor_insert_before(XListCursor *cursor, int value) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (cursor->list->count == INT_MAX) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *new = xlist_node_alloc(cursor->list, value); // nuevo nodo
+    if (!new) return LIST_ERR_ALLOC;
+
+    xlist_link(cursor->list, cursor->prev, cursor->node, new, cursor->pos);
+    cursor->prev = new; // el cursor sigue en el mismo nodo
+    cursor->pos++;
+    return LIST_OK;
+}
+
+ListStatus xlist_cursor_insert_after(XListCursor *cursor, int value) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+    if (cursor->list->count == INT_MAX) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *new = xlist_node_alloc(cursor->list, value); // nuevo nodo
+    if (!new) return LIST_ERR_ALLOC;
+
+    Node *next = xlist_other(cursor->node, cursor->prev);
+
+    xlist_link(cursor->list, cursor->node, next, new, cursor->pos + 1);
+    return LIST_OK;
+}
+
+ListStatus xlist_cursor_erase(XListCursor *cursor) {
+    if (!cursor || !cursor->list) return LIST_ERR_NULL;
+    if (!cursor->node) return LIST_ERR_OUT_OF_RANGE;
+
+    Node *actual = cursor->node;
+    Node *next = xlist_other(actual, cursor->prev);
+
+    cursor->node = next; // el cursor pasa al siguiente, en la misma posición
+    xlist_unlink(cursor->list, cursor->prev, actual, next, cursor->pos);
+    node_pool_release(cursor->list->pool, actual); // liberamos
+    return LIST_OK;
+}
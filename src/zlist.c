@@ -0,0 +1,459 @@
+#include "zlist.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
+
+#define ZLIST_VARINT_MAX 5 // bytes de una diferencia de 32 bits en varint
+
+/*
+ * Bloque de hasta ZLIST_CHUNK elementos. first se guarda fuera de los bytes
+ * codificados; los count - 1 elementos siguientes son varints a partir de
+ * offset y terminan donde empieza el bloque siguiente.
+ */
+typedef struct Chunk {
+    long long sum; // suma de los elementos del bloque
+    size_t offset; // primer varint del bloque en data
+    int first; // mínimo del bloque
+    int last; // máximo del bloque
+    int count; // elementos en el bloque
+} Chunk;
+
+struct ZList {
+    Chunk *chunks;
+    size_t chunk_count;
+    size_t chunk_capacity;
+    unsigned char *data; // diferencias codificadas de todos los bloques
+    size_t data_used;
+    size_t data_capacity;
+    int count; // número total de elementos
+};
+
+static inline size_t zlist_varint_size(uint32_t delta) {
+    size_t size = 1;
+
+    while (delta >= 0x80) {
+        delta >>= 7;
+        size++;
+    }
+
+    return size;
+}
+
+static inline void zlist_varint_write(ZList *list, uint32_t delta) {
+    unsigned char *p = list->data + list->data_used;
+
+    while (delta >= 0x80) { // 7 bits por byte, el bit alto indica que sigue otro
+        *p++ = (unsigned char)(delta | 0x80);
+        delta >>= 7;
+    }
+
+    *p++ = (unsigned char)delta;
+    list->data_used = (size_t)(p - list->data);
+}
+
+static inline const unsigned char *zlist_varint_read(const unsigned char *p, uint32_t *delta) {
+    uint32_t result = *p++;
+
+    if (result < 0x80) { // caso común: diferencia menor que 128
+        *delta = result;
+        return p;
+    }
+
+    result &= 0x7f;
+    for (int shift = 7;; shift += 7) {
+        uint32_t byte = *p++;
+
+        result |= (byte & 0x7f) << shift;
+        if (byte < 0x80) break;
+    }
+
+    *delta = result;
+    return p;
+}
+
+/* Diferencia entre dos elementos ordenados; cabe en 32 bits sin signo. */
+static inline uint32_t zlist_delta(int prev, int value) {
+    return (uint32_t)value - (uint32_t)prev;
+}
+
+static inline int zlist_apply_delta(int prev, uint32_t delta) {
+    return (int)((uint32_t)prev + delta);
+}
+
+static ListStatus zlist_reserve(ZList *list, size_t chunks, size_t bytes) {
+    if (chunks > list->chunk_capacity) {
+        size_t capacity = list->chunk_capacity ? list->chunk_capacity : 4;
+        while (capacity < chunks) capacity *= 2;
+
+        Chunk *grown = realloc(list->chunks, capacity * sizeof(Chunk));
+        if (!grown) return LIST_ERR_ALLOC;
+
+        list->chunks = grown;
+        list->chunk_capacity = capacity;
+    }
+
+    if (bytes > list->data_capacity) {
+        size_t capacity = list->data_capacity ? list->data_capacity : 64;
+        while (capacity < bytes) capacity *= 2;
+
+        unsigned char *grown = realloc(list->data, capacity);
+        if (!grown) return LIST_ERR_ALLOC;
+
+        list->data = grown;
+        list->data_capacity = capacity;
+    }
+
+    return LIST_OK;
+}
+
+/* Agrega value al final; la memoria ya está reservada y el orden validado. */
+static void zlist_append(ZList *list, int value) {
+    Chunk *chunk = list->chunk_count ? &list->chunks[list->chunk_count - 1] : NULL;
+
+    if (!chunk || chunk->count == ZLIST_CHUNK) { // bloque nuevo
+        chunk = &list->chunks[list->chunk_count++];
+        chunk->sum = 0;
+        chunk->offset = list->data_used;
+        chunk->first = value;
+        chunk->count = 0;
+    } else {
+        zlist_varint_write(list, zlist_delta(chunk->last, value));
+    }
+
+    chunk->last = value;
+    chunk->sum += value;
+    chunk->count++;
+    list->count++;
+}
+
+/* Decodifica el bloque i completo en out, que tiene lugar para ZLIST_CHUNK elementos. */
+static void zlist_decode_chunk(ZList *list, size_t i, int *out) {
+    const Chunk *chunk = &list->chunks[i];
+    const unsigned char *p = list->data + chunk->offset;
+    int value = chunk->first;
+
+    out[0] = value;
+    for (int j = 1; j < chunk->count; j++) {
+        uint32_t delta;
+
+        p = zlist_varint_read(p, &delta);
+        value = zlist_apply_delta(value, delta);
+        out[j] = value;
+    }
+}
+
+/* Primer bloque cuyo máximo es >= value, o chunk_count si no hay. */
+static size_t zlist_lower_chunk(ZList *list, int value) {
+    size_t low = 0;
+    size_t high = list->chunk_count;
+
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+
+        if (list->chunks[mid].last < value) low = mid + 1;
+        else high = mid;
+    }
+
+    return low;
+}
+
+/*
+ * Devuelve la posición (base 0) de la primera aparición de value o -1. Por
+ * estar ordenada, solo el primer bloque con máximo >= value puede tenerla.
+ */
+static int zlist_find(ZList *list, int value) {
+    size_t i = zlist_lower_chunk(list, value);
+
+    if (i == list->chunk_count || list->chunks[i].first > value) return -1; // cae entre bloques o fuera
+
+    const Chunk *chunk = &list->chunks[i];
+    const unsigned char *p = list->data + chunk->offset;
+    int actual = chunk->first;
+
+    for (int j = 0;; j++) {
+        if (actual == value) return (int)(i * ZLIST_CHUNK) + j; // se encuentra
+        if (actual > value || j + 1 == chunk->count) return -1;
+
+        uint32_t delta;
+        p = zlist_varint_read(p, &delta);
+        actual = zlist_apply_delta(actual, delta);
+    }
+}
+
+ZList *zlist_create(void) {
+    ZList *list = malloc(sizeof(ZList)); // creamos la lista
+
+    if (!list) return NULL;
+
+    list->chunks = NULL;
+    list->chunk_count = 0;
+    list->chunk_capacity = 0;
+    list->data = NULL;
+    list->data_used = 0;
+    list->data_capacity = 0;
+    list->count = 0;
+    return list;
+}
+
+ListStatus zlist_size(ZList *list, int *count) {
+    if (!list) return LIST_ERR_NULL;
+
+    *count = list->count;
+    return LIST_OK;
+}
+
+ListStatus zlist_size_bytes(ZList *list, size_t *bytes) {
+    if (!list) return LIST_ERR_NULL;
+    if (!bytes) return LIST_ERR_NULL;
+
+    *bytes = sizeof(ZList) + list->chunk_capacity * sizeof(Chunk) + list->data_capacity;
+    return LIST_OK;
+}
+
+ListStatus zlist_is_empty(ZList *list, bool *is_empty) {
+    if (!list) return LIST_ERR_NULL;
+
+    *is_empty = (list->count == 0);
+    return LIST_OK;
+}
+
+ListStatus zlist_contains(ZList *list, int value, bool *found) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->count) return LIST_ERR_EMPTY;
+
+    *found = zlist_find(list, value) >= 0;
+    return LIST_OK;
+}
+
+ListStatus zlist_push_back(ZList *list, int value) {
+    if (!list) return LIST_ERR_NULL;
+    if (list->count && value < list->chunks[list->chunk_count - 1].last) return LIST_ERR_ORDER;
+    if (list->count == INT_MAX) return LIST_ERR_OUT_OF_RANGE;
+
+    ListStatus status = zlist_reserve(list, list->chunk_count + 1, list->data_used + ZLIST_VARINT_MAX);
+    if (status != LIST_OK) return status;
+
+    zlist_append(list, value);
+    return LIST_OK;
+}
+
+ListStatus zlist_extend(ZList *list, const int *values, size_t n) {
+    if (!list) return LIST_ERR_NULL;
+    if (n == 0) return LIST_OK;
+    if (!values) return LIST_ERR_NULL;
+    if (n > (size_t)(INT_MAX - list->count)) return LIST_ERR_OUT_OF_RANGE;
+
+    // primera pasada: validamos el orden y medimos los bytes que ocupará
+    size_t bytes = 0;
+    int in_chunk = list->count ? list->chunks[list->chunk_count - 1].count : ZLIST_CHUNK;
+    int prev = list->count ? list->chunks[list->chunk_count - 1].last : values[0];
+    size_t new_chunks = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        if (values[i] < prev) return LIST_ERR_ORDER;
+
+        if (in_chunk == ZLIST_CHUNK) { // empieza un bloque, sin varint
+            in_chunk = 0;
+            new_chunks++;
+        } else {
+            bytes += zlist_varint_size(zlist_delta(prev, values[i]));
+        }
+
+        in_chunk++;
+        prev = values[i];
+    }
+
+    ListStatus status = zlist_reserve(list, list->chunk_count + new_chunks, list->data_used + bytes);
+    if (status != LIST_OK) return status;
+
+    for (size_t i = 0; i < n; i++) {
+        zlist_append(list, values[i]);
+    }
+
+    return LIST_OK;
+}
+
+ListStatus zlist_search_for_value(ZList *list, int value, int *pos) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->count) return LIST_ERR_EMPTY;
+
+    int found = zlist_find(list, value);
+    if (found < 0) return LIST_ERR_NOT_FOUND;
+
+    *pos = found;
+    return LIST_OK;
+}
+
+ListStatus zlist_search_for_position(ZList *list, int pos, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->count) return LIST_ERR_EMPTY;
+    if (pos > list->count || pos < 1) return LIST_ERR_OUT_OF_RANGE;
+
+    const Chunk *chunk = &list->chunks[(size_t)(pos - 1) / ZLIST_CHUNK];
+    const unsigned char *p = list->data + chunk->offset;
+    int actual = chunk->first;
+
+    for (int j = (pos - 1) % ZLIST_CHUNK; j > 0; j--) { // decodificamos hasta la posición
+        uint32_t delta;
+
+        p = zlist_varint_read(p, &delta);
+        actual = zlist_apply_delta(actual, delta);
+    }
+
+    *value = actual;
+    return LIST_OK;
+}
+
+ListStatus zlist_front(ZList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->count) return LIST_ERR_EMPTY;
+
+    *value = list->chunks[0].first;
+    return LIST_OK;
+}
+
+ListStatus zlist_back(ZList *list, int *value) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->count) return LIST_ERR_EMPTY;
+
+    *value = list->chunks[list->chunk_count - 1].last;
+    return LIST_OK;
+}
+
+ListStatus zlist_clear(ZList *list) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->count) return LIST_ERR_EMPTY;
+
+    free(list->chunks);
+    free(list->data);
+    list->chunks = NULL;
+    list->chunk_count = 0;
+    list->chunk_capacity = 0;
+    list->data = NULL;
+    list->data_used = 0;
+    list->data_capacity = 0;
+    list->count = 0;
+    return LIST_OK;
+}
+
+ListStatus zlist_sum(ZList *list, int *sum) {
+    if (!list) return LIST_ERR_NULL;
+    if (!list->count) return LIST_ERR_EMPTY;
+
+    long long total = 0;
+
+    for (size_t i = 0; i < list->chunk_count; i++) {
+        total += list->chunks[i].sum;
+    }
+
+    *sum = (int)total;
+    return LIST_OK;
+}
+
+ListStatus zlist_to_array(ZList *list, int *out, size_t cap, size_t *written) {
+    if (!list) return LIST_ERR_NULL;
+    if (!written) return LIST_ERR_NULL;
+
+    *written = 0;
+    if (!list->count) return LIST_ERR_EMPTY;
+    if (!out && cap) return LIST_ERR_NULL;
+
+    size_t i = 0;
+    size_t c = 0;
+
+    // bloques completos directo al destino
+    for (; c < list->chunk_count && cap - i >= (size_t)list->chunks[c].count; c++) {
+        zlist_decode_chunk(list, c, out + i);
+        i += (size_t)list->chunks[c].count;
+    }
+
+    if (c < list->chunk_count && i < cap) { // el último bloque no cabe completo
+        int buffer[ZLIST_CHUNK];
+
+        zlist_decode_chunk(list, c, buffer);
+        for (int j = 0; i < cap; j++) out[i++] = buffer[j];
+    }
+
+    *written = i;
+    return i == (size_t)list->count ? LIST_OK : LIST_ERR_OUT_OF_RANGE;
+}
+
+ListStatus zlist_destroy(ZList *list) {
+    if (!list) return LIST_ERR_NULL;
+
+    free(list->chunks);
+    free(list->data);
+    free(list);
+    return LIST_OK;
+}
+
+void zlist_show(ZList *list) {
+    int buffer[ZLIST_CHUNK];
+
+    printf("\n\nElementos de la lista: ");
+
+    for (size_t c = 0; c < list->chunk_count; c++) {
+        zlist_decode_chunk(list, c, buffer);
+
+        printf("[ ");
+        for (int j = 0; j < list->chunks[c].count; j++) {
+            printf("%d ", buffer[j]);
+        }
+        printf("] -> ");
+    }
+
+    printf("NULL");
+}
+
+ListStatus zlist_cursor_begin(ZList *list, ZListCursor *cursor) {
+    if (!list) return LIST_ERR_NULL;
+    if (!cursor) return LIST_ERR_NULL;
+
+    cursor->list = list;
+    cursor->chunk = 0;
+    cursor->index = 0;
+
+    if (list->count) {
+        cursor->offset = list->chunks[0].offset;
+        cursor->value = list->chunks[0].first;
+    }
+
+    return LIST_OK;
+}
+
+ListStatus zlist_cursor_next(ZListCursor *cursor) {
+    if (!cursor) return LIST_ERR_NULL;
+
+    ZList *list = cursor->list;
+    if (cursor->chunk >= list->chunk_count) return LIST_ERR_OUT_OF_RANGE;
+
+    if (cursor->index + 1 < list->chunks[cursor->chunk].count) { // siguiente varint del bloque
+        uint32_t delta;
+        const unsigned char *p = zlist_varint_read(list->data + cursor->offset, &delta);
+
+        cursor->offset = (size_t)(p - list->data);
+        cursor->value = zlist_apply_delta(cursor->value, delta);
+        cursor->index++;
+        return LIST_OK;
+    }
+
+    cursor->chunk++; // pasamos al siguiente bloque
+    cursor->index = 0;
+
+    if (cursor->chunk < list->chunk_count) {
+        cursor->offset = list->chunks[cursor->chunk].offset;
+        cursor->value = list->chunks[cursor->chunk].first;
+    }
+
+    return LIST_OK;
+}
+
+ListStatus zlist_cursor_get(ZListCursor *cursor, int *value) {
+    if (!cursor) return LIST_ERR_NULL;
+    if (cursor->chunk >= cursor->list->chunk_count) return LIST_ERR_OUT_OF_RANGE;
+
+    *value = cursor->value;
+    return LIST_OK;
+}